@@ -2,5 +2,10 @@
 #define __BT_H__
 
 #include <dazzle.h>
+#include "bt_grid.h"
+#include "bt_vt.h"
+#include "bt_scrollback.h"
+#include "bt_pty.h"
+#include "bt_search.h"
 
-#endif // __BS_H__
\ No newline at end of file
+#endif // __BS_H__
@@ -0,0 +1,458 @@
+#ifndef __BT_GRID_H__
+#define __BT_GRID_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include <dazzle.h>
+#include <dt_glyphs.h>
+#include <dt_fallback.h>
+#include "../utils/uniwidth.h"
+
+//======== Defines ========//
+
+#define BT_ATTR_BOLD      (1 << 0)
+#define BT_ATTR_DIM       (1 << 1)
+#define BT_ATTR_ITALIC    (1 << 2)
+#define BT_ATTR_UNDERLINE (1 << 3)
+#define BT_ATTR_BLINK     (1 << 4)
+#define BT_ATTR_REVERSE   (1 << 5)
+#define BT_ATTR_INVISIBLE (1 << 6)
+#define BT_ATTR_STRIKE    (1 << 7)
+#define BT_ATTR_WIDE      (1 << 8) //takes this cell and the one after it
+#define BT_ATTR_WIDE_CONT (1 << 9) //the right half of a wide character, never drawn itself
+
+#define BT_DEFAULT_FG 7
+#define BT_DEFAULT_BG 0
+
+#define BT_MAX_COLS 4096
+#define BT_MAX_ROWS 4096
+
+//======== Structure Definitions ========//
+
+//One character cell, 8 bytes
+typedef struct {
+    uint32_t codepoint; //0 is an empty cell
+    uint16_t attrs;
+    uint8_t fg;         //palette indices
+    uint8_t bg;
+} bt_cell_t;
+
+//The screen as a grid of cells. Changing a cell marks it dirty, rendering
+//draws only the dirty ones, so a refresh that changes a few digits draws a few cells.
+typedef struct {
+    dazzle_allocator_t alloc;
+    uint32_t cols;
+    uint32_t rows;
+    bt_cell_t* cells;
+    uint32_t* lines; //lines[row] is the row of cells shown there, scrolling only moves these
+
+    //One bit per cell, rows padded to whole words, and one bit per row that has any set
+    uint64_t* dirty_cells;
+    uint64_t* dirty_rows;
+    uint32_t row_words;
+
+    uint32_t palette[256]; //dazzle colors, xterm's 256 until changed
+
+    uint64_t redrawn; //cells drawn by bt_grid_render so far
+} bt_grid_t;
+
+//======== Internal Functions ========//
+
+static inline uint32_t __bt_rgb(uint32_t r, uint32_t g, uint32_t b){
+    return 0xFF000000 | b << 16 | g << 8 | r;
+}
+
+static void __bt_default_palette(uint32_t* palette){
+    static const uint8_t base[16][3] = {
+        {0x00, 0x00, 0x00}, {0xCD, 0x00, 0x00}, {0x00, 0xCD, 0x00}, {0xCD, 0xCD, 0x00},
+        {0x00, 0x00, 0xEE}, {0xCD, 0x00, 0xCD}, {0x00, 0xCD, 0xCD}, {0xE5, 0xE5, 0xE5},
+        {0x7F, 0x7F, 0x7F}, {0xFF, 0x00, 0x00}, {0x00, 0xFF, 0x00}, {0xFF, 0xFF, 0x00},
+        {0x5C, 0x5C, 0xFF}, {0xFF, 0x00, 0xFF}, {0x00, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF},
+    };
+    for(uint32_t i = 0; i < 16; i++) palette[i] = __bt_rgb(base[i][0], base[i][1], base[i][2]);
+
+    //6x6x6 color cube, then 24 grays
+    for(uint32_t i = 0; i < 216; i++){
+        uint32_t r = i / 36, g = i / 6 % 6, b = i % 6;
+        palette[16 + i] = __bt_rgb(r ? r * 40 + 55 : 0, g ? g * 40 + 55 : 0, b ? b * 40 + 55 : 0);
+    }
+    for(uint32_t i = 0; i < 24; i++) palette[232 + i] = __bt_rgb(i * 10 + 8, i * 10 + 8, i * 10 + 8);
+}
+
+static inline bt_cell_t* __bt_row(const bt_grid_t* grid, uint32_t row){
+    return grid->cells + (size_t)grid->lines[row] * grid->cols;
+}
+
+//Each copy doubles what is filled, storing the cell one field at a time is several times slower
+static void __bt_fill_cells(bt_cell_t* dst, size_t count, bt_cell_t cell){
+    if(count == 0) return;
+    dst[0] = cell;
+    for(size_t done = 1; done < count;){
+        size_t n = done < count - done ? done : count - done;
+        memcpy(dst + done, dst, n * sizeof(bt_cell_t));
+        done += n;
+    }
+}
+
+static inline void __bt_mark(bt_grid_t* grid, uint32_t col, uint32_t row){
+    grid->dirty_cells[(size_t)row * grid->row_words + col / 64] |= (uint64_t)1 << (col % 64);
+    grid->dirty_rows[row / 64] |= (uint64_t)1 << (row % 64);
+}
+
+//Marks rows first to last, a word of bits at a time
+static inline void __bt_mark_rows(bt_grid_t* grid, uint32_t first, uint32_t last){
+    for(uint32_t w = first / 64; w <= last / 64; w++){
+        uint64_t bits = ~(uint64_t)0;
+        if(w == first / 64) bits &= ~(uint64_t)0 << (first % 64);
+        if(w == last / 64) bits &= ~(uint64_t)0 >> (63 - last % 64);
+        grid->dirty_rows[w] |= bits;
+    }
+}
+
+static inline bool __bt_same_cell(bt_cell_t a, bt_cell_t b){
+    return a.codepoint == b.codepoint && a.attrs == b.attrs && a.fg == b.fg && a.bg == b.bg;
+}
+
+//Draws one cell, wide characters cover the cell after them too
+static bool __bt_draw_cell(dazzle_context_t* ctx, bt_grid_t* grid, const font_chain_t* fonts, uint32_t col, uint32_t row, uint32_t x, uint32_t y){
+    bt_cell_t cell = __bt_row(grid, row)[col];
+    const font_t* first = &fonts->fonts[0];
+    uint32_t cw = first->suggested_width, ch = first->suggested_height;
+    uint32_t px = x + col * cw, py = y + row * ch;
+    //A right half in the first column has no left half to draw it, it is drawn as itself
+    if((cell.attrs & BT_ATTR_WIDE_CONT) && col > 0) return true;
+    if((cell.attrs & BT_ATTR_WIDE) && col + 1 < grid->cols) cw *= 2;
+
+    //Bold brightens the first eight colors
+    uint32_t fg_index = (cell.attrs & BT_ATTR_BOLD) && cell.fg < 8 ? cell.fg + 8 : cell.fg;
+    uint32_t fg = grid->palette[fg_index], bg = grid->palette[cell.bg];
+    if(cell.attrs & BT_ATTR_REVERSE){
+        uint32_t t = fg;
+        fg = bg;
+        bg = t;
+    }
+    if(cell.attrs & BT_ATTR_DIM) fg = (fg & 0xFF000000) | (fg >> 1 & 0x007F7F7F);
+
+    //Blank cells have no glyph but keep their lines, invisible ones are only background
+    bool success;
+    if(cell.codepoint == 0 || cell.codepoint == ' ' || (cell.attrs & BT_ATTR_WIDE_CONT) || (cell.attrs & BT_ATTR_INVISIBLE)){
+        success = dazzle_fill_rect(ctx, px, py, cw, ch, bg);
+        if(cell.attrs & BT_ATTR_INVISIBLE) return success;
+    } else {
+        uint32_t which, glyph = font_chain_glyph(fonts, cell.codepoint, &which);
+        success = draw_glyph_cell(ctx, fonts->fonts[which], glyph, px, py, cw, ch, fg, bg);
+    }
+    if(cell.attrs & BT_ATTR_UNDERLINE) success &= dazzle_fill_rect(ctx, px, py + ch - 1, cw, 1, fg);
+    if(cell.attrs & BT_ATTR_STRIKE) success &= dazzle_fill_rect(ctx, px, py + ch / 2, cw, 1, fg);
+    return success;
+}
+
+//======== Functions ========//
+
+/*
+ * @brief Creates a grid of blank cells, all of them dirty
+ *
+ * @param alloc The allocator to use
+ * @param cols Columns, 1 to BT_MAX_COLS
+ * @param rows Rows, 1 to BT_MAX_ROWS
+ * @return bt_grid_t* The grid, or NULL on failure
+*/
+bt_grid_t* bt_grid_create(dazzle_allocator_t alloc, uint32_t cols, uint32_t rows){
+    if(cols == 0 || rows == 0 || cols > BT_MAX_COLS || rows > BT_MAX_ROWS) return NULL;
+
+    uint32_t row_words = (cols + 63) / 64;
+    size_t cells = (size_t)cols * rows * sizeof(bt_cell_t);
+    size_t dirty = ((size_t)row_words * rows + (rows + 63) / 64) * sizeof(uint64_t);
+    size_t lines = ((size_t)rows * sizeof(uint32_t) + 7) & ~(size_t)7;
+    bt_grid_t* grid = alloc.malloc(sizeof(bt_grid_t) + cells + dirty + lines);
+    if(grid == NULL) return NULL;
+
+    memset(grid, 0, sizeof(bt_grid_t));
+    grid->alloc = alloc;
+    grid->cols = cols;
+    grid->rows = rows;
+    grid->row_words = row_words;
+    grid->cells = (bt_cell_t*)(grid + 1);
+    grid->dirty_cells = (uint64_t*)((uint8_t*)grid->cells + cells);
+    grid->dirty_rows = grid->dirty_cells + (size_t)row_words * rows;
+    grid->lines = (uint32_t*)((uint8_t*)grid->dirty_cells + dirty);
+    for(uint32_t row = 0; row < rows; row++) grid->lines[row] = row;
+    __bt_default_palette(grid->palette);
+
+    bt_cell_t blank = {0, 0, BT_DEFAULT_FG, BT_DEFAULT_BG};
+    __bt_fill_cells(grid->cells, (size_t)cols * rows, blank);
+    memset(grid->dirty_cells, 0, dirty);
+    for(uint32_t row = 0; row < rows; row++)
+        for(uint32_t col = 0; col < cols; col++) __bt_mark(grid, col, row);
+    return grid;
+}
+
+/*
+ * @brief Frees a grid
+ *
+ * @param grid The grid
+*/
+void bt_grid_destroy(bt_grid_t* grid){
+    if(grid == NULL) return;
+    grid->alloc.free(grid);
+}
+
+/*
+ * @brief Reads a cell
+ *
+ * @param grid The grid
+ * @param col The column, in bounds
+ * @param row The row, in bounds
+ * @return const bt_cell_t* The cell, change it through bt_grid_set
+*/
+static inline const bt_cell_t* bt_grid_cell(const bt_grid_t* grid, uint32_t col, uint32_t row){
+    return &__bt_row(grid, row)[col];
+}
+
+/*
+ * @brief Changes a cell, marking it dirty only if it actually changed
+ *
+ * @param grid The grid
+ * @param col The column, out of bounds is ignored
+ * @param row The row, out of bounds is ignored
+ * @param cell The new contents
+*/
+static inline void bt_grid_set(bt_grid_t* grid, uint32_t col, uint32_t row, bt_cell_t cell){
+    if(col >= grid->cols || row >= grid->rows) return;
+    bt_cell_t* dst = &__bt_row(grid, row)[col];
+    if(__bt_same_cell(*dst, cell)) return;
+
+    //Overwriting half of a wide character leaves the other half blank
+    if((dst->attrs & BT_ATTR_WIDE) && !(cell.attrs & BT_ATTR_WIDE) && col + 1 < grid->cols){
+        dst[1] = (bt_cell_t){' ', dst[1].attrs & ~BT_ATTR_WIDE_CONT, dst[1].fg, dst[1].bg};
+        __bt_mark(grid, col + 1, row);
+    }
+    if((dst->attrs & BT_ATTR_WIDE_CONT) && !(cell.attrs & BT_ATTR_WIDE_CONT) && col > 0){
+        dst[-1] = (bt_cell_t){' ', dst[-1].attrs & ~BT_ATTR_WIDE, dst[-1].fg, dst[-1].bg};
+        __bt_mark(grid, col - 1, row);
+    }
+    *dst = cell;
+    __bt_mark(grid, col, row);
+}
+
+/*
+ * @brief Marks cells dirty whether they changed or not, like after the screen was lost
+ *
+ * @param grid The grid
+ * @param col The first column
+ * @param row The first row
+ * @param cols Columns to mark, clipped to the grid
+ * @param rows Rows to mark, clipped to the grid
+*/
+void bt_grid_damage(bt_grid_t* grid, uint32_t col, uint32_t row, uint32_t cols, uint32_t rows){
+    if(col >= grid->cols || row >= grid->rows) return;
+    if(cols > grid->cols - col) cols = grid->cols - col;
+    if(rows > grid->rows - row) rows = grid->rows - row;
+    for(uint32_t r = row; r < row + rows; r++)
+        for(uint32_t c = col; c < col + cols; c++) __bt_mark(grid, c, r);
+}
+
+/*
+ * @brief Fills a run of cells on one row with the same cell, for erasing
+ *
+ * @param grid The grid
+ * @param col The first column
+ * @param row The row
+ * @param count How many cells, clipped to the row
+ * @param cell The contents
+*/
+void bt_grid_fill(bt_grid_t* grid, uint32_t col, uint32_t row, uint32_t count, bt_cell_t cell){
+    if(col >= grid->cols || row >= grid->rows) return;
+    if(count > grid->cols - col) count = grid->cols - col;
+    for(uint32_t c = col; c < col + count; c++) bt_grid_set(grid, c, row, cell);
+}
+
+/*
+ * @brief Writes characters along one row, wide ones take two cells
+ *
+ * Combining and zero width characters are dropped, there is no cell to put
+ * them in. A wide character that does not fit at the end of the row is not
+ * written, the caller wraps it.
+ *
+ * @param grid The grid
+ * @param col The first column, moved past what was written
+ * @param row The row
+ * @param cps The characters
+ * @param count How many there are
+ * @param attrs BT_ATTR_* bits for all of them
+ * @param fg The palette index of the text
+ * @param bg The palette index behind it
+ * @return uint32_t The number of characters written, the rest did not fit
+*/
+uint32_t bt_grid_write(bt_grid_t* grid, uint32_t* col, uint32_t row, const uint32_t* cps, uint32_t count, uint16_t attrs, uint8_t fg, uint8_t bg){
+    if(row >= grid->rows) return 0;
+    uint32_t c = *col, i = 0;
+    attrs &= ~(BT_ATTR_WIDE | BT_ATTR_WIDE_CONT);
+
+    for(; i < count && c < grid->cols; i++){
+        uint32_t cp = cps[i];
+        uint32_t width = cp >= 0x20 && cp < 0x7F ? 1 : uni_class(cp) & UNI_WIDTH_MASK;
+        if(width == 0) continue;
+        if(width == 2){
+            if(c + 1 >= grid->cols) break;
+            bt_grid_set(grid, c, row, (bt_cell_t){cp, attrs | BT_ATTR_WIDE, fg, bg});
+            bt_grid_set(grid, c + 1, row, (bt_cell_t){0, attrs | BT_ATTR_WIDE_CONT, fg, bg});
+            c += 2;
+            continue;
+        }
+        bt_grid_set(grid, c, row, (bt_cell_t){cp, attrs, fg, bg});
+        c++;
+    }
+    *col = c;
+    return i;
+}
+
+/*
+ * @brief Writes a run of printable ascii along one row, one cell per byte
+ *
+ * @param grid The grid
+ * @param col The first column, moved past what was written
+ * @param row The row
+ * @param s The bytes, 0x20 to 0x7E
+ * @param count How many there are
+ * @param attrs BT_ATTR_* bits for all of them
+ * @param fg The palette index of the text
+ * @param bg The palette index behind it
+ * @return uint32_t The number of bytes written, the rest did not fit
+*/
+uint32_t bt_grid_write_ascii(bt_grid_t* grid, uint32_t* col, uint32_t row, const uint8_t* s, uint32_t count, uint16_t attrs, uint8_t fg, uint8_t bg){
+    if(row >= grid->rows || *col >= grid->cols) return 0;
+    if(count > grid->cols - *col) count = grid->cols - *col;
+    attrs &= ~(BT_ATTR_WIDE | BT_ATTR_WIDE_CONT);
+    if(count == 0) return 0;
+
+    //Only the ends can cut a wide character in half, so they go through bt_grid_set
+    //first and everything between is compared and stored directly
+    uint32_t c = *col;
+    bt_grid_set(grid, c, row, (bt_cell_t){s[0], attrs, fg, bg});
+    if(count > 1) bt_grid_set(grid, c + count - 1, row, (bt_cell_t){s[count - 1], attrs, fg, bg});
+    //The changed cells of each word of the row are collected and marked together
+    bt_cell_t* line = __bt_row(grid, row);
+    uint64_t* dirty = grid->dirty_cells + (size_t)row * grid->row_words;
+    uint64_t changed = 0, any = 0;
+    for(uint32_t x = c + 1; x + 1 < c + count; x++){
+        bt_cell_t cell = {s[x - c], attrs, fg, bg};
+        if(!__bt_same_cell(line[x], cell)){
+            line[x] = cell;
+            changed |= (uint64_t)1 << (x % 64);
+        }
+        if(x % 64 == 63 || x + 2 == c + count){
+            dirty[x / 64] |= changed;
+            any |= changed;
+            changed = 0;
+        }
+    }
+    if(any) grid->dirty_rows[row / 64] |= (uint64_t)1 << (row % 64);
+    *col += count;
+    return count;
+}
+
+/*
+ * @brief Moves the rows of a region up or down, the rows it uncovers are blank
+ *
+ * No cells are copied, the region's entries in the row map are rotated, so
+ * scrolling costs the same for any width.
+ *
+ * @param grid The grid
+ * @param top The first row of the region
+ * @param bottom The last row of the region
+ * @param lines Rows to move up, negative moves down
+ * @param blank What the uncovered rows are filled with
+*/
+void bt_grid_scroll(bt_grid_t* grid, uint32_t top, uint32_t bottom, int32_t lines, bt_cell_t blank){
+    if(bottom >= grid->rows || top > bottom || lines == 0) return;
+    uint32_t height = bottom - top + 1, n = lines < 0 ? (uint32_t)-lines : (uint32_t)lines;
+    if(n > height) n = height;
+
+    //Rotating by three reversals needs no scratch space
+    uint32_t* map = grid->lines + top;
+    uint32_t split = lines > 0 ? n : height - n;
+    uint32_t spans[3][2] = {{0, split}, {split, height}, {0, height}};
+    for(uint32_t k = 0; k < 3; k++){
+        for(uint32_t a = spans[k][0], b = spans[k][1]; a + 1 < b; a++, b--){
+            uint32_t t = map[a];
+            map[a] = map[b - 1];
+            map[b - 1] = t;
+        }
+    }
+
+    uint32_t first = lines > 0 ? height - n : 0;
+    for(uint32_t row = first; row < first + n; row++) __bt_fill_cells(__bt_row(grid, top + row), grid->cols, blank);
+
+    //Every row of the region now shows something else. Its bits are one block,
+    //set at once, then the padding past the last column is cleared again.
+    uint64_t* bits = grid->dirty_cells + (size_t)top * grid->row_words;
+    memset(bits, 0xFF, (size_t)height * grid->row_words * sizeof(uint64_t));
+    if(grid->cols % 64 != 0){
+        uint64_t last = ((uint64_t)1 << (grid->cols % 64)) - 1;
+        for(uint32_t row = 0; row < height; row++) bits[(size_t)row * grid->row_words + grid->row_words - 1] = last;
+    }
+    __bt_mark_rows(grid, top, bottom);
+}
+
+/*
+ * @brief Draws the dirty cells and clears the dirty bits
+ *
+ * @param ctx The context to draw into
+ * @param grid The grid
+ * @param fonts The fonts, cells are the size of the first one's
+ * @param x The left edge of the grid on screen
+ * @param y The top edge of the grid on screen
+ * @param drawn Grown to cover the pixels drawn, like to present just them, may be NULL.
+ *              The context's own damage is left to its other consumers.
+ * @return bool False if a draw failed, the cells are clean anyway
+*/
+bool bt_grid_render(dazzle_context_t* ctx, bt_grid_t* grid, const font_chain_t* fonts, uint32_t x, uint32_t y, dazzle_rect_t* drawn){
+    DAZZLE_TRACE_SCOPE("bt_grid_render");
+    bool success = true;
+    uint32_t row_sets = (grid->rows + 63) / 64;
+    uint32_t left = UINT32_MAX, right = 0, top = UINT32_MAX, bottom = 0; //cells drawn, right and bottom exclusive
+
+    for(uint32_t w = 0; w < row_sets; w++){
+        for(uint64_t rows = grid->dirty_rows[w]; rows != 0; rows &= rows - 1){
+            uint32_t row = w * 64 + __builtin_ctzll(rows);
+            uint64_t* cells = grid->dirty_cells + (size_t)row * grid->row_words;
+            const bt_cell_t* line = __bt_row(grid, row);
+            for(uint32_t k = 0; k < grid->row_words; k++){
+                for(uint64_t bits = cells[k]; bits != 0; bits &= bits - 1){
+                    uint32_t col = k * 64 + __builtin_ctzll(bits), first = col, end = col + 1;
+                    //A right half is only still dirty when its left half was not, that draws both
+                    if((line[col].attrs & BT_ATTR_WIDE_CONT) && col > 0){
+                        success &= __bt_draw_cell(ctx, grid, fonts, col - 1, row, x, y);
+                        first = col - 1;
+                    } else {
+                        success &= __bt_draw_cell(ctx, grid, fonts, col, row, x, y);
+                        if((line[col].attrs & BT_ATTR_WIDE) && col + 1 < grid->cols){
+                            if((col + 1) % 64 != 0) bits &= ~((uint64_t)1 << ((col + 1) % 64));
+                            else cells[k + 1] &= ~(uint64_t)1;
+                            end = col + 2;
+                        }
+                    }
+                    if(first < left) left = first;
+                    if(end > right) right = end;
+                    if(row < top) top = row;
+                    if(row + 1 > bottom) bottom = row + 1;
+                    grid->redrawn++;
+                }
+                cells[k] = 0;
+            }
+        }
+        grid->dirty_rows[w] = 0;
+    }
+
+    if(drawn != NULL && left < right){
+        uint32_t cw = fonts->fonts[0].suggested_width, ch = fonts->fonts[0].suggested_height;
+        dazzle_rect_t r = {x + left * cw, y + top * ch, (right - left) * cw, (bottom - top) * ch};
+        dazzle_rect_union(drawn, &r);
+    }
+    return success;
+}
+
+#endif // __BT_GRID_H__
@@ -0,0 +1,340 @@
+#ifndef __BT_PTY_H__
+#define __BT_PTY_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <pty.h>
+#include <utmp.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <sys/timerfd.h>
+#include <sys/wait.h>
+#include <dazzle.h>
+#include <dt_fallback.h>
+#include "bt_grid.h"
+#include "bt_vt.h"
+
+//======== Defines ========//
+
+#define BT_PTY_READ_SIZE (64 * 1024) //one read, reused for the whole session
+#define BT_PTY_DEFAULT_HZ 60
+
+//======== Structure Definitions ========//
+
+//Where and how often the grid is drawn
+typedef struct {
+    dazzle_context_t* ctx;
+    const font_chain_t* fonts;
+    uint32_t x; //top left of the grid on screen
+    uint32_t y;
+    uint32_t hz; //frames per second at most, the display's refresh rate, 0 for BT_PTY_DEFAULT_HZ
+
+    //Shows a frame once the grid was drawn, like dazzle_drm_present, may be NULL.
+    //damage is what the grid drew for this frame, merged into one rectangle.
+    void (*present)(void* user, dazzle_context_t* ctx, dazzle_rect_t damage);
+    void* user;
+} bt_pty_output_t;
+
+//Reads a pty into a terminal and draws it, decoupled: output is parsed as fast as
+//it arrives, the grid's dirty cells pile up between frames and are drawn at most
+//once per frame, however many reads there were.
+typedef struct {
+    dazzle_allocator_t alloc;
+    int fd; //master side, nonblocking
+    pid_t child; //-1 if the pty was opened by the caller
+    int epoll_fd;
+    int timer_fd; //fires when output stopped before a frame was due
+    bt_vt_t* vt;
+    bt_pty_output_t output;
+
+    uint64_t frame_ns;
+    uint64_t last_frame; //CLOCK_MONOTONIC
+    bool damaged;        //parsed since the last frame
+    bool timer_armed;
+    bool hangup;         //the other side closed, nothing more will come
+
+    uint64_t bytes_read;
+    uint64_t frames;
+
+    //Input the pty could not take yet, sent as it drains. Waiting for it instead
+    //would deadlock with a program that echoes: it blocks on output nobody reads.
+    uint8_t* pending;
+    size_t pending_start;
+    size_t pending_end;
+    size_t pending_size;
+
+    uint8_t buffer[BT_PTY_READ_SIZE];
+} bt_pty_t;
+
+//======== Internal Functions ========//
+
+static inline uint64_t __bt_pty_now(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void __bt_pty_frame(bt_pty_t* pty, uint64_t now){
+    DAZZLE_TRACE_SCOPE("bt_pty_frame");
+    bt_pty_output_t* out = &pty->output;
+    if(out->ctx != NULL){
+        //Only what the grid drew, the context's damage may have other consumers, like a capture
+        dazzle_rect_t drawn = {0, 0, 0, 0};
+        bt_grid_render(out->ctx, pty->vt->grid, out->fonts, out->x, out->y, &drawn);
+        if(out->present != NULL) out->present(out->user, out->ctx, drawn);
+    }
+    pty->last_frame = now;
+    pty->damaged = false;
+    pty->frames++;
+}
+
+//One shot at the time the next frame is due
+static void __bt_pty_arm(bt_pty_t* pty){
+    uint64_t due = pty->last_frame + pty->frame_ns;
+    struct itimerspec when = {{0, 0}, {(time_t)(due / 1000000000ull), (long)(due % 1000000000ull)}};
+    if(timerfd_settime(pty->timer_fd, TFD_TIMER_ABSTIME, &when, NULL) == 0) pty->timer_armed = true;
+}
+
+//Reads until the pty is empty or a frame is due, whichever is first
+static void __bt_pty_drain(bt_pty_t* pty){
+    DAZZLE_TRACE_SCOPE("bt_pty_drain");
+    for(;;){
+        ssize_t n = read(pty->fd, pty->buffer, sizeof(pty->buffer));
+        if(n < 0 && errno == EINTR) continue;
+        if(n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+        //EIO is how Linux says every slave fd was closed
+        if(n <= 0){
+            pty->hangup = true;
+            return;
+        }
+        bt_vt_feed(pty->vt, pty->buffer, (size_t)n);
+        pty->bytes_read += (uint64_t)n;
+        pty->damaged = true;
+        if(__bt_pty_now() - pty->last_frame >= pty->frame_ns) return;
+    }
+}
+
+//Writes what it can without blocking, false on an error other than a full pty
+static bool __bt_pty_send(bt_pty_t* pty, const uint8_t** data, size_t* len){
+    while(*len > 0){
+        ssize_t n = write(pty->fd, *data, *len);
+        if(n < 0 && errno == EINTR) continue;
+        if(n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return true;
+        if(n <= 0) return false;
+        *data += n;
+        *len -= (size_t)n;
+    }
+    return true;
+}
+
+//Waits for room in the pty only while something is pending
+static bool __bt_pty_want_out(bt_pty_t* pty, bool out){
+    struct epoll_event in = {.events = EPOLLIN | (out ? EPOLLOUT : 0), .data.fd = pty->fd};
+    return epoll_ctl(pty->epoll_fd, EPOLL_CTL_MOD, pty->fd, &in) == 0;
+}
+
+static bool __bt_pty_flush(bt_pty_t* pty){
+    const uint8_t* data = pty->pending + pty->pending_start;
+    size_t len = pty->pending_end - pty->pending_start;
+    bool ok = __bt_pty_send(pty, &data, &len);
+    pty->pending_start = pty->pending_end - len;
+    if(!ok || len == 0){
+        pty->pending_start = pty->pending_end = 0;
+        __bt_pty_want_out(pty, false);
+    }
+    return ok;
+}
+
+//======== Functions ========//
+
+/*
+ * @brief Runs a terminal on a pty opened by the caller, like the master of openpty
+ *
+ * @param alloc The allocator to use
+ * @param fd The master side, made nonblocking, the caller still closes it
+ * @param vt The terminal to feed, its grid is what gets drawn
+ * @param output Where to draw, a NULL ctx only parses
+ * @return bt_pty_t* The loop, or NULL on failure
+*/
+bt_pty_t* bt_pty_attach(dazzle_allocator_t alloc, int fd, bt_vt_t* vt, const bt_pty_output_t* output){
+    if(fd < 0 || vt == NULL || output == NULL) return NULL;
+    if(output->ctx != NULL && output->fonts == NULL) return NULL;
+
+    bt_pty_t* pty = alloc.malloc(sizeof(bt_pty_t));
+    if(pty == NULL) return NULL;
+    memset(pty, 0, offsetof(bt_pty_t, buffer));
+    pty->alloc = alloc;
+    pty->fd = fd;
+    pty->child = -1;
+    pty->vt = vt;
+    pty->output = *output;
+    pty->frame_ns = 1000000000ull / (output->hz != 0 ? output->hz : BT_PTY_DEFAULT_HZ);
+    pty->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    pty->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+    int flags = fcntl(fd, F_GETFL);
+    struct epoll_event in = {.events = EPOLLIN, .data.fd = fd};
+    struct epoll_event timer = {.events = EPOLLIN, .data.fd = pty->timer_fd};
+    if(pty->epoll_fd < 0 || pty->timer_fd < 0 || flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0 ||
+       epoll_ctl(pty->epoll_fd, EPOLL_CTL_ADD, fd, &in) < 0 || epoll_ctl(pty->epoll_fd, EPOLL_CTL_ADD, pty->timer_fd, &timer) < 0){
+        if(pty->epoll_fd >= 0) close(pty->epoll_fd);
+        if(pty->timer_fd >= 0) close(pty->timer_fd);
+        alloc.free(pty);
+        return NULL;
+    }
+    return pty;
+}
+
+/*
+ * @brief Starts a program on a new pty and runs a terminal on it
+ *
+ * @param alloc The allocator to use
+ * @param argv The program and its arguments, looked up in PATH
+ * @param vt The terminal to feed, the pty gets its grid's size
+ * @param output Where to draw, a NULL ctx only parses
+ * @return bt_pty_t* The loop, or NULL on failure
+*/
+bt_pty_t* bt_pty_spawn(dazzle_allocator_t alloc, char* const argv[], bt_vt_t* vt, const bt_pty_output_t* output){
+    if(argv == NULL || argv[0] == NULL || vt == NULL) return NULL;
+    struct winsize size = {(unsigned short)vt->grid->rows, (unsigned short)vt->grid->cols, 0, 0};
+    int master, slave;
+    if(openpty(&master, &slave, NULL, NULL, &size) < 0) return NULL;
+
+    pid_t child = fork();
+    if(child < 0){
+        close(master);
+        close(slave);
+        return NULL;
+    }
+    if(child == 0){
+        close(master);
+        if(login_tty(slave) < 0) _exit(127);
+        execvp(argv[0], argv);
+        _exit(127);
+    }
+    close(slave);
+
+    bt_pty_t* pty = bt_pty_attach(alloc, master, vt, output);
+    if(pty == NULL){
+        close(master);
+        kill(child, SIGHUP);
+        waitpid(child, NULL, 0);
+        return NULL;
+    }
+    pty->child = child;
+    return pty;
+}
+
+/*
+ * @brief Waits for output and handles it, drawing a frame if one is due
+ *
+ * Under a flood of output every call parses for up to a frame and then draws
+ * once. When output stops short of a frame, a timer brings the last frame in.
+ *
+ * @param pty The loop
+ * @param timeout_ms How long to wait for something to happen, -1 for ever
+ * @return bool False once the other side hung up, or on an error
+*/
+bool bt_pty_poll(bt_pty_t* pty, int timeout_ms){
+    struct epoll_event events[2];
+    int count = epoll_wait(pty->epoll_fd, events, 2, timeout_ms);
+    if(count < 0) return errno == EINTR;
+
+    for(int i = 0; i < count; i++){
+        if(events[i].data.fd == pty->timer_fd){
+            uint64_t expirations;
+            if(read(pty->timer_fd, &expirations, sizeof(expirations)) < 0 && errno != EAGAIN) return false;
+            pty->timer_armed = false;
+            continue;
+        }
+        if(events[i].events & EPOLLOUT) __bt_pty_flush(pty);
+        if(events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) __bt_pty_drain(pty);
+    }
+
+    if(pty->damaged){
+        //The last output is drawn right away, no more reads will bring its frame
+        uint64_t now = __bt_pty_now();
+        if(now - pty->last_frame >= pty->frame_ns || pty->hangup) __bt_pty_frame(pty, now);
+        else if(!pty->timer_armed) __bt_pty_arm(pty);
+    }
+    return !pty->hangup;
+}
+
+/*
+ * @brief Sends input to the program, like keys, never waiting
+ *
+ * What the pty can not take now, like the rest of a big paste, is kept and sent
+ * by bt_pty_poll as the program reads it, in order with later writes.
+ *
+ * @param pty The loop
+ * @param data The bytes
+ * @param len How many there are
+ * @return bool False on an error, or if there was no memory to keep the rest
+*/
+bool bt_pty_write(bt_pty_t* pty, const void* data, size_t len){
+    const uint8_t* p = data;
+    if(pty->pending_end == pty->pending_start && !__bt_pty_send(pty, &p, &len)) return false;
+    if(len == 0) return true;
+
+    size_t kept = pty->pending_end - pty->pending_start;
+    if(pty->pending_end + len > pty->pending_size){
+        uint8_t* pending = pty->pending;
+        if(kept + len > pty->pending_size){
+            size_t size = pty->pending_size != 0 ? pty->pending_size : BT_PTY_READ_SIZE;
+            while(size < kept + len) size *= 2;
+            pending = pty->alloc.malloc(size);
+            if(pending == NULL) return false;
+            pty->pending_size = size;
+        }
+        if(kept > 0) memmove(pending, pty->pending + pty->pending_start, kept);
+        if(pending != pty->pending){
+            if(pty->pending != NULL) pty->alloc.free(pty->pending);
+            pty->pending = pending;
+        }
+        pty->pending_start = 0;
+        pty->pending_end = kept;
+    }
+    memcpy(pty->pending + pty->pending_end, p, len);
+    pty->pending_end += len;
+    return kept != 0 || __bt_pty_want_out(pty, true);
+}
+
+/*
+ * @brief Tells the program the terminal's size changed
+ *
+ * @param pty The loop
+ * @param cols Columns
+ * @param rows Rows
+ * @return bool False on failure
+*/
+bool bt_pty_resize(bt_pty_t* pty, uint32_t cols, uint32_t rows){
+    struct winsize size = {(unsigned short)rows, (unsigned short)cols, 0, 0};
+    return ioctl(pty->fd, TIOCSWINSZ, &size) == 0;
+}
+
+/*
+ * @brief Stops the loop, a spawned program gets SIGHUP and is waited for
+ *
+ * @param pty The loop
+*/
+void bt_pty_destroy(bt_pty_t* pty){
+    if(pty == NULL) return;
+    if(pty->pending != NULL) pty->alloc.free(pty->pending);
+    close(pty->epoll_fd);
+    close(pty->timer_fd);
+    if(pty->child > 0){
+        close(pty->fd);
+        kill(pty->child, SIGHUP);
+        waitpid(pty->child, NULL, 0);
+    }
+    pty->alloc.free(pty);
+}
+
+#endif // __BT_PTY_H__
@@ -0,0 +1,264 @@
+#ifndef __BT_SCROLLBACK_H__
+#define __BT_SCROLLBACK_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <dazzle.h>
+#include "bt_grid.h"
+
+#ifdef __DAZZLE_IMPL__
+    #define __UTF8_IMPL__
+#endif
+#include "../utils/utf8.h"
+#include "../utils/uniwidth.h"
+
+//======== Defines ========//
+
+//Smallest cap, enough for a line BT_MAX_COLS wide with every cell different
+#define BT_SCROLLBACK_MIN_BYTES (64 * 1024)
+
+//======== Structure Definitions ========//
+
+//Cells in a row that look the same apart from their characters
+typedef struct {
+    uint16_t length; //characters, a wide one counts once
+    uint16_t attrs;  //BT_ATTR_* without the wide bits, the characters' widths say that
+    uint8_t fg;
+    uint8_t bg;
+} bt_scrollback_run_t;
+
+//Rows that scrolled off the screen, oldest first, in a fixed amount of memory.
+//A line is stored as its attribute runs and its characters as UTF-8, trailing
+//blanks dropped, so a line of 80 plain characters takes about 100 bytes instead of 640.
+//Lines are numbered from 0 in the order they were pushed, the numbers stay the same
+//as older lines are evicted: first to first + count - 1 can be read.
+typedef struct {
+    dazzle_allocator_t alloc;
+    uint64_t first;
+    uint32_t count;
+
+    //Ring of byte offsets, index[n & index_mask] is where line n starts.
+    //Offsets only grow, the byte is data[offset % data_size].
+    uint64_t* index;
+    uint32_t index_mask;
+
+    //Ring of lines. A line never wraps around the end, the space left there is skipped.
+    uint8_t* data;
+    size_t data_size;
+    uint64_t head; //offset of the oldest line
+    uint64_t tail; //offset the next line goes to
+
+    //Held while lines are added or dropped. Readers on another thread, like a
+    //search in the background, hold it while they look at lines.
+    pthread_mutex_t lock;
+} bt_scrollback_t;
+
+//======== Internal Functions ========//
+
+//Each line starts with this, then its runs, then its text
+typedef struct {
+    uint32_t text_length;
+    uint16_t run_count;
+    uint16_t cols; //cells the line had when it was pushed
+} __bt_scrollback_header_t;
+
+static inline bool __bt_scrollback_same(bt_cell_t cell, const bt_scrollback_run_t* run){
+    return (cell.attrs & ~(BT_ATTR_WIDE | BT_ATTR_WIDE_CONT)) == run->attrs && cell.fg == run->fg && cell.bg == run->bg;
+}
+
+static inline const __bt_scrollback_header_t* __bt_scrollback_line(const bt_scrollback_t* sb, uint64_t line){
+    return (const __bt_scrollback_header_t*)(sb->data + sb->index[line & sb->index_mask] % sb->data_size);
+}
+
+//Drops the oldest line
+static void __bt_scrollback_evict(bt_scrollback_t* sb){
+    sb->first++;
+    sb->count--;
+    sb->head = sb->count > 0 ? sb->index[sb->first & sb->index_mask] : sb->tail;
+}
+
+//======== Functions ========//
+
+/*
+ * @brief Creates an empty scrollback
+ *
+ * Everything comes out of one block of max_bytes. An eighth of it indexes the
+ * lines, so lines that average under 64 bytes run out of index before the rest
+ * fills up, either way the oldest lines are dropped.
+ *
+ * @param alloc The allocator to use
+ * @param max_bytes The memory it may use, at least BT_SCROLLBACK_MIN_BYTES
+ * @return bt_scrollback_t* The scrollback, or NULL on failure
+*/
+bt_scrollback_t* bt_scrollback_create(dazzle_allocator_t alloc, size_t max_bytes){
+    if(max_bytes < BT_SCROLLBACK_MIN_BYTES) return NULL;
+
+    //A power of two lines, so finding one is a mask
+    size_t entries = 1;
+    while(entries * 2 * sizeof(uint64_t) <= max_bytes / 8 && entries < ((size_t)1 << 31)) entries *= 2;
+    size_t header = (sizeof(bt_scrollback_t) + 7) & ~(size_t)7;
+
+    bt_scrollback_t* sb = alloc.malloc(max_bytes);
+    if(sb == NULL) return NULL;
+    memset(sb, 0, sizeof(bt_scrollback_t));
+    sb->alloc = alloc;
+    sb->index = (uint64_t*)((uint8_t*)sb + header);
+    sb->index_mask = (uint32_t)(entries - 1);
+    sb->data = (uint8_t*)(sb->index + entries);
+    sb->data_size = (max_bytes - header - entries * sizeof(uint64_t)) & ~(size_t)3;
+    if(pthread_mutex_init(&sb->lock, NULL) != 0){
+        alloc.free(sb);
+        return NULL;
+    }
+    return sb;
+}
+
+/*
+ * @brief Frees a scrollback
+ *
+ * @param sb The scrollback
+*/
+void bt_scrollback_destroy(bt_scrollback_t* sb){
+    if(sb == NULL) return;
+    pthread_mutex_destroy(&sb->lock);
+    sb->alloc.free(sb);
+}
+
+/*
+ * @brief Forgets every line, the numbering carries on
+ *
+ * @param sb The scrollback
+*/
+void bt_scrollback_clear(bt_scrollback_t* sb){
+    pthread_mutex_lock(&sb->lock);
+    sb->first += sb->count;
+    sb->count = 0;
+    sb->head = sb->tail;
+    pthread_mutex_unlock(&sb->lock);
+}
+
+/*
+ * @brief Adds a line as the newest, dropping the oldest ones if there is no room
+ *
+ * Takes the same arguments as the scrolled callback of bt_vt_callbacks_t.
+ *
+ * @param sb The scrollback
+ * @param cells The row
+ * @param cols Cells in the row, up to BT_MAX_COLS
+*/
+void bt_scrollback_push(bt_scrollback_t* sb, const bt_cell_t* cells, uint32_t cols){
+    if(cols > BT_MAX_COLS) cols = BT_MAX_COLS;
+
+    //Trailing blanks come back from bt_scrollback_read anyway
+    while(cols > 0){
+        bt_cell_t cell = cells[cols - 1];
+        if((cell.codepoint != 0 && cell.codepoint != ' ') || cell.attrs != 0 || cell.bg != BT_DEFAULT_BG) break;
+        cols--;
+    }
+
+    //Measured first, so only as many old lines as needed make room
+    uint32_t runs = 0;
+    size_t text = 0;
+    bt_scrollback_run_t run = {0, 0, 0, 0};
+    for(uint32_t i = 0; i < cols; i++){
+        if(cells[i].attrs & BT_ATTR_WIDE_CONT) continue;
+        if(runs == 0 || !__bt_scrollback_same(cells[i], &run)){
+            run = (bt_scrollback_run_t){0, cells[i].attrs & ~(BT_ATTR_WIDE | BT_ATTR_WIDE_CONT), cells[i].fg, cells[i].bg};
+            runs++;
+        }
+        uint8_t bytes[4];
+        text += cells[i].codepoint < 0x80 ? 1 : utf8_encode(cells[i].codepoint, bytes);
+    }
+    size_t size = (sizeof(__bt_scrollback_header_t) + runs * sizeof(bt_scrollback_run_t) + text + 3) & ~(size_t)3;
+
+    pthread_mutex_lock(&sb->lock);
+    //Skip the end of the ring rather than split the line
+    if(sb->tail % sb->data_size + size > sb->data_size) sb->tail += sb->data_size - sb->tail % sb->data_size;
+    while(sb->count > 0 && (sb->tail + size - sb->head > sb->data_size || sb->count > sb->index_mask)) __bt_scrollback_evict(sb);
+    if(sb->count == 0) sb->head = sb->tail;
+
+    uint8_t* dst = sb->data + sb->tail % sb->data_size;
+    __bt_scrollback_header_t* header = (__bt_scrollback_header_t*)dst;
+    bt_scrollback_run_t* out = (bt_scrollback_run_t*)(header + 1);
+    uint8_t* utf8 = (uint8_t*)(out + runs);
+    *header = (__bt_scrollback_header_t){(uint32_t)text, (uint16_t)runs, (uint16_t)cols};
+
+    bt_scrollback_run_t* current = out - 1;
+    for(uint32_t i = 0; i < cols; i++){
+        bt_cell_t cell = cells[i];
+        if(cell.attrs & BT_ATTR_WIDE_CONT) continue;
+        if(current < out || !__bt_scrollback_same(cell, current))
+            *++current = (bt_scrollback_run_t){0, cell.attrs & ~(BT_ATTR_WIDE | BT_ATTR_WIDE_CONT), cell.fg, cell.bg};
+        current->length++;
+        if(cell.codepoint >= 0x80) utf8 += utf8_encode(cell.codepoint, utf8);
+        else *utf8++ = cell.codepoint == 0 ? ' ' : (uint8_t)cell.codepoint;
+    }
+
+    sb->index[(sb->first + sb->count) & sb->index_mask] = sb->tail;
+    sb->count++;
+    sb->tail += size;
+    pthread_mutex_unlock(&sb->lock);
+}
+
+/*
+ * @brief Gets the text of a line, for searching without turning it back into cells
+ *
+ * While lines are pushed on another thread, hold sb->lock until done with the text.
+ *
+ * @param sb The scrollback
+ * @param line The line number
+ * @param length Set to the length in bytes
+ * @return const uint8_t* The UTF-8 text, trailing blanks dropped, or NULL if the line is not kept
+*/
+const uint8_t* bt_scrollback_text(const bt_scrollback_t* sb, uint64_t line, size_t* length){
+    if(line < sb->first || line - sb->first >= sb->count) return NULL;
+    const __bt_scrollback_header_t* header = __bt_scrollback_line(sb, line);
+    *length = header->text_length;
+    return (const uint8_t*)((const bt_scrollback_run_t*)(header + 1) + header->run_count);
+}
+
+/*
+ * @brief Turns a line back into cells, in time proportional to its length only
+ *
+ * @param sb The scrollback
+ * @param line The line number
+ * @param cells Where to put it
+ * @param cols Cells to fill, the line is cut or padded with blanks to this
+ * @return bool False if the line is not kept
+*/
+bool bt_scrollback_read(const bt_scrollback_t* sb, uint64_t line, bt_cell_t* cells, uint32_t cols){
+    if(line < sb->first || line - sb->first >= sb->count) return false;
+    const __bt_scrollback_header_t* header = __bt_scrollback_line(sb, line);
+    const bt_scrollback_run_t* runs = (const bt_scrollback_run_t*)(header + 1);
+    const uint8_t* text = (const uint8_t*)(runs + header->run_count);
+
+    utf8_dec_state_t state = {0, 0, 0};
+    uint32_t cps[256], have = 0, next = 0, x = 0;
+    size_t used = 0;
+    for(uint32_t r = 0; r < header->run_count && x < cols; r++){
+        bt_scrollback_run_t run = runs[r];
+        for(uint32_t k = 0; k < run.length && x < cols; k++){
+            if(next == have){
+                size_t consumed;
+                have = (uint32_t)utf8_decode_buf(&state, text + used, header->text_length - used, cps, 256, &consumed);
+                used += consumed;
+                next = 0;
+                if(have == 0) break;
+            }
+            uint32_t cp = cps[next++];
+            if(cp >= 0x80 && (uni_class(cp) & UNI_WIDTH_MASK) == 2 && x + 1 < cols){
+                cells[x++] = (bt_cell_t){cp, run.attrs | BT_ATTR_WIDE, run.fg, run.bg};
+                cells[x++] = (bt_cell_t){0, run.attrs | BT_ATTR_WIDE_CONT, run.fg, run.bg};
+            } else {
+                cells[x++] = (bt_cell_t){cp, run.attrs, run.fg, run.bg};
+            }
+        }
+    }
+    __bt_fill_cells(cells + x, cols - x, (bt_cell_t){0, 0, BT_DEFAULT_FG, BT_DEFAULT_BG});
+    return true;
+}
+
+#endif // __BT_SCROLLBACK_H__
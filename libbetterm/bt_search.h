@@ -0,0 +1,345 @@
+#ifndef __BT_SEARCH_H__
+#define __BT_SEARCH_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <dazzle.h>
+#include "bt_scrollback.h"
+
+#if defined(__SSE2__) && !defined(BT_NO_SIMD)
+    #include <emmintrin.h>
+    #define BT_SIMD_SSE2 1
+#endif
+
+//======== Defines ========//
+
+#define BT_SEARCH_MAX_NEEDLE 256
+#define BT_SEARCH_CHUNK 256 //lines looked at per hold of the scrollback's lock
+
+//Flags of bt_search_init
+#define BT_SEARCH_IGNORE_CASE (1 << 0) //A to Z match a to z, other characters match only themselves
+#define BT_SEARCH_BACKWARD    (1 << 1) //newest line first, like searching up from the bottom of the screen
+
+//What a step of a search came to
+enum {
+    BT_SEARCH_FOUND, //the match was filled in, the next step carries on after it
+    BT_SEARCH_MORE,  //looked at as many lines as it was allowed to, nothing yet
+    BT_SEARCH_DONE,  //nothing more to find, forward searches see lines pushed later
+};
+
+//======== Structure Definitions ========//
+
+typedef struct {
+    uint64_t line;   //line number in the scrollback
+    uint32_t offset; //bytes into the line's bt_scrollback_text
+    uint32_t length; //bytes
+    uint32_t column; //cell it starts at, as bt_scrollback_read lays the line out
+    uint32_t width;  //cells it covers
+} bt_search_match_t;
+
+//A search that is carried on in steps, from wherever the last one stopped. It
+//looks at the lines as they are stored, their UTF-8 text, and never turns them
+//back into cells. A match is within one line.
+typedef struct {
+    uint8_t needle[BT_SEARCH_MAX_NEEDLE]; //lowercase if BT_SEARCH_IGNORE_CASE
+    uint32_t length;
+    uint32_t flags;
+    uint8_t first[2]; //the needle's first and last bytes, in both cases
+    uint8_t last[2];
+
+    //Where the next step carries on. Forward, matches start at offset or after it,
+    //backward, before it.
+    bool started;
+    uint64_t line;
+    uint32_t offset;
+} bt_search_t;
+
+//Called for every match of a search in the background, on its thread and with
+//the scrollback unlocked, the line may be gone by the time it is shown
+typedef bool (*bt_search_found_t)(void* user, const bt_search_match_t* match); //false stops the search
+
+//A search on its own thread, while the terminal keeps pushing lines
+typedef struct {
+    dazzle_allocator_t alloc;
+    bt_scrollback_t* sb;
+    bt_search_t search;
+    bt_search_found_t found;
+    void* user;
+    pthread_t thread;
+    _Atomic bool cancel;
+    _Atomic bool done;
+} bt_search_job_t;
+
+//======== Internal Functions ========//
+
+static inline uint8_t __bt_search_fold(uint8_t c){
+    return c >= 'A' && c <= 'Z' ? c | 0x20 : c;
+}
+
+static inline bool __bt_search_equal(const bt_search_t* search, const uint8_t* text){
+    if(!(search->flags & BT_SEARCH_IGNORE_CASE)) return memcmp(text, search->needle, search->length) == 0;
+    for(uint32_t i = 0; i < search->length; i++)
+        if(__bt_search_fold(text[i]) != search->needle[i]) return false;
+    return true;
+}
+
+//First match starting at from or after it. Candidates are where both the first
+//and the last byte of the needle are in place, 16 starts at a time.
+static bool __bt_search_find(const bt_search_t* search, const uint8_t* text, size_t len, size_t from, size_t* at){
+    size_t n = search->length;
+    if(len < n || from > len - n) return false;
+    size_t end = len - n + 1; //one past the last start
+    size_t i = from;
+#ifdef BT_SIMD_SSE2
+    __m128i first0 = _mm_set1_epi8((char)search->first[0]), first1 = _mm_set1_epi8((char)search->first[1]);
+    __m128i last0 = _mm_set1_epi8((char)search->last[0]), last1 = _mm_set1_epi8((char)search->last[1]);
+    for(; i + 16 <= end; i += 16){
+        __m128i head = _mm_loadu_si128((const __m128i*)(text + i));
+        __m128i tail = _mm_loadu_si128((const __m128i*)(text + i + n - 1));
+        __m128i heads = _mm_or_si128(_mm_cmpeq_epi8(head, first0), _mm_cmpeq_epi8(head, first1));
+        __m128i tails = _mm_or_si128(_mm_cmpeq_epi8(tail, last0), _mm_cmpeq_epi8(tail, last1));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(heads, tails));
+        while(mask != 0){
+            size_t k = i + (size_t)__builtin_ctz(mask);
+            if(__bt_search_equal(search, text + k)){
+                *at = k;
+                return true;
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for(; i < end; i++){
+        if(text[i] != search->first[0] && text[i] != search->first[1]) continue;
+        if(__bt_search_equal(search, text + i)){
+            *at = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+//Last match starting before limit
+static bool __bt_search_find_last(const bt_search_t* search, const uint8_t* text, size_t len, size_t limit, size_t* at){
+    size_t k;
+    bool found = false;
+    for(size_t from = 0; from < limit && __bt_search_find(search, text, len, from, &k) && k < limit; from = k + 1){
+        *at = k;
+        found = true;
+    }
+    return found;
+}
+
+//Cells taken by a piece of a line's text
+static uint32_t __bt_search_cells(const uint8_t* text, size_t len){
+    utf8_dec_state_t state = {0, 0, 0};
+    uint32_t cps[64], cells = 0;
+    size_t used = 0;
+    while(used < len){
+        if(text[used] < 0x80 && state.bytes_remaining == 0){
+            cells++;
+            used++;
+            continue;
+        }
+        size_t consumed;
+        size_t have = utf8_decode_buf(&state, text + used, len - used, cps, 64, &consumed);
+        used += consumed;
+        for(size_t i = 0; i < have; i++)
+            cells += cps[i] >= 0x80 && (uni_class(cps[i]) & UNI_WIDTH_MASK) == 2 ? 2 : 1;
+        if(consumed == 0) break;
+    }
+    return cells;
+}
+
+static void __bt_search_report(const bt_search_t* search, uint64_t line, const uint8_t* text, size_t at, bt_search_match_t* match){
+    uint32_t column = __bt_search_cells(text, at);
+    *match = (bt_search_match_t){line, (uint32_t)at, search->length, column, __bt_search_cells(text + at, search->length)};
+}
+
+//Up to count lines, with the lock held
+static int __bt_search_lines(bt_search_t* search, const bt_scrollback_t* sb, uint32_t count, bt_search_match_t* match){
+    if(sb->count == 0) return BT_SEARCH_DONE;
+    uint64_t end = sb->first + sb->count;
+    bool backward = search->flags & BT_SEARCH_BACKWARD;
+    if(!search->started){
+        search->started = true;
+        search->line = backward ? end - 1 : sb->first;
+        search->offset = backward ? UINT32_MAX : 0;
+    }
+
+    size_t len, at;
+    if(backward){
+        //Lines older than where it got to were all dropped
+        if(search->line < sb->first) return BT_SEARCH_DONE;
+        if(search->line >= end){
+            search->line = end - 1;
+            search->offset = UINT32_MAX;
+        }
+        for(;;){
+            const uint8_t* text = bt_scrollback_text(sb, search->line, &len);
+            if(__bt_search_find_last(search, text, len, search->offset, &at)){
+                __bt_search_report(search, search->line, text, at, match);
+                search->offset = (uint32_t)at;
+                return BT_SEARCH_FOUND;
+            }
+            search->offset = 0;
+            if(search->line == sb->first) return BT_SEARCH_DONE;
+            search->line--;
+            search->offset = UINT32_MAX;
+            if(--count == 0) return BT_SEARCH_MORE;
+        }
+    }
+
+    //Lines dropped since the last step are skipped
+    if(search->line < sb->first){
+        search->line = sb->first;
+        search->offset = 0;
+    }
+    for(; count > 0 && search->line < end; count--, search->line++, search->offset = 0){
+        const uint8_t* text = bt_scrollback_text(sb, search->line, &len);
+        if(__bt_search_find(search, text, len, search->offset, &at)){
+            __bt_search_report(search, search->line, text, at, match);
+            search->offset = (uint32_t)at + 1;
+            return BT_SEARCH_FOUND;
+        }
+    }
+    return search->line < end ? BT_SEARCH_MORE : BT_SEARCH_DONE;
+}
+
+//======== Functions ========//
+
+/*
+ * @brief Sets up a search, it starts at the oldest line, or the newest if BT_SEARCH_BACKWARD
+ *
+ * @param search The search
+ * @param needle What to look for, UTF-8
+ * @param length Its length in bytes, up to BT_SEARCH_MAX_NEEDLE
+ * @param flags BT_SEARCH_* flags
+ * @return bool False if the needle is empty, too long or starts inside a character
+*/
+bool bt_search_init(bt_search_t* search, const char* needle, size_t length, uint32_t flags){
+    if(length == 0 || length > BT_SEARCH_MAX_NEEDLE || ((uint8_t)needle[0] & 0xC0) == 0x80) return false;
+    memset(search, 0, sizeof(bt_search_t));
+    search->length = (uint32_t)length;
+    search->flags = flags;
+    for(size_t i = 0; i < length; i++){
+        uint8_t c = (uint8_t)needle[i];
+        search->needle[i] = flags & BT_SEARCH_IGNORE_CASE ? __bt_search_fold(c) : c;
+    }
+
+    uint8_t first = search->needle[0], last = search->needle[length - 1];
+    bool fold = flags & BT_SEARCH_IGNORE_CASE;
+    search->first[0] = first;
+    search->first[1] = fold && first >= 'a' && first <= 'z' ? first - 0x20 : first;
+    search->last[0] = last;
+    search->last[1] = fold && last >= 'a' && last <= 'z' ? last - 0x20 : last;
+    return true;
+}
+
+/*
+ * @brief Moves where a search carries on from, like the top of what is on screen
+ *
+ * @param search The search
+ * @param line The line number
+ * @param offset Bytes into the line, forward searches match from here, backward ones before here
+*/
+void bt_search_seek(bt_search_t* search, uint64_t line, uint32_t offset){
+    search->started = true;
+    search->line = line;
+    search->offset = offset;
+}
+
+/*
+ * @brief Looks for the next match, from where the last step stopped
+ *
+ * The scrollback is locked for BT_SEARCH_CHUNK lines at a time, so lines can be
+ * pushed from another thread in between. Lines dropped meanwhile are skipped.
+ *
+ * @param search The search
+ * @param sb The scrollback
+ * @param max_lines Lines to look at before giving up with BT_SEARCH_MORE, at least 1
+ * @param match Filled in on BT_SEARCH_FOUND
+ * @return int BT_SEARCH_FOUND, BT_SEARCH_MORE or BT_SEARCH_DONE
+*/
+int bt_search_step(bt_search_t* search, bt_scrollback_t* sb, uint32_t max_lines, bt_search_match_t* match){
+    DAZZLE_TRACE_SCOPE("bt_search_step");
+    if(max_lines == 0) max_lines = 1;
+    for(;;){
+        uint32_t count = max_lines < BT_SEARCH_CHUNK ? max_lines : BT_SEARCH_CHUNK;
+        max_lines -= count;
+        pthread_mutex_lock(&sb->lock);
+        int result = __bt_search_lines(search, sb, count, match);
+        pthread_mutex_unlock(&sb->lock);
+        if(result != BT_SEARCH_MORE || max_lines == 0) return result;
+    }
+}
+
+static void* __bt_search_run(void* arg){
+    bt_search_job_t* job = arg;
+    bt_search_match_t match;
+    while(!atomic_load_explicit(&job->cancel, memory_order_relaxed)){
+        int result = bt_search_step(&job->search, job->sb, BT_SEARCH_CHUNK, &match);
+        if(result == BT_SEARCH_DONE) break;
+        if(result == BT_SEARCH_FOUND && !job->found(job->user, &match)) break;
+    }
+    atomic_store_explicit(&job->done, true, memory_order_release);
+    return NULL;
+}
+
+/*
+ * @brief Runs a search to the end on a new thread, see bt_search_found_t
+ *
+ * @param alloc The allocator to use
+ * @param sb The scrollback, it has to outlive the search
+ * @param search The search, copied, it carries on from where it is
+ * @param found Called with every match
+ * @param user Passed to found
+ * @return bt_search_job_t* The search, or NULL on failure
+*/
+bt_search_job_t* bt_search_start(dazzle_allocator_t alloc, bt_scrollback_t* sb, const bt_search_t* search, bt_search_found_t found, void* user){
+    if(sb == NULL || search == NULL || found == NULL) return NULL;
+    bt_search_job_t* job = alloc.malloc(sizeof(bt_search_job_t));
+    if(job == NULL) return NULL;
+    job->alloc = alloc;
+    job->sb = sb;
+    job->search = *search;
+    job->found = found;
+    job->user = user;
+    atomic_init(&job->cancel, false);
+    atomic_init(&job->done, false);
+    if(pthread_create(&job->thread, NULL, __bt_search_run, job) != 0){
+        alloc.free(job);
+        return NULL;
+    }
+    return job;
+}
+
+/*
+ * @brief Tells if a search in the background got to the end or was stopped by found
+ *
+ * @param job The search
+ * @return bool True once no more matches will come
+*/
+bool bt_search_done(const bt_search_job_t* job){
+    return atomic_load_explicit(&job->done, memory_order_acquire);
+}
+
+/*
+ * @brief Stops a search in the background if it is still going, waits for it and frees it
+ *
+ * @param job The search
+ * @param search Set to where it got to, to carry on from later, may be NULL
+*/
+void bt_search_stop(bt_search_job_t* job, bt_search_t* search){
+    if(job == NULL) return;
+    atomic_store_explicit(&job->cancel, true, memory_order_relaxed);
+    pthread_join(job->thread, NULL);
+    if(search != NULL) *search = job->search;
+    job->alloc.free(job);
+}
+
+#endif // __BT_SEARCH_H__
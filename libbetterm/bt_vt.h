@@ -0,0 +1,769 @@
+#ifndef __BT_VT_H__
+#define __BT_VT_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <dazzle.h>
+#include "bt_grid.h"
+
+#ifdef __DAZZLE_IMPL__
+    #define __UTF8_IMPL__
+#endif
+#include "../utils/utf8.h"
+#include "../utils/uniwidth.h"
+
+//======== Defines ========//
+
+#define BT_VT_MAX_PARAMS 16
+#define BT_VT_MAX_INTERMEDIATES 2
+#define BT_VT_MAX_STRING 4096 //OSC and DCS payloads, longer ones are cut
+#define BT_VT_TAB_WIDTH 8
+
+//States of the DEC parser, see vt100.net/emu/dec_ansi_parser
+enum {
+    BT_VT_GROUND,
+    BT_VT_ESCAPE,
+    BT_VT_ESCAPE_INTERMEDIATE,
+    BT_VT_CSI_ENTRY,
+    BT_VT_CSI_PARAM,
+    BT_VT_CSI_INTERMEDIATE,
+    BT_VT_CSI_IGNORE,
+    BT_VT_DCS_ENTRY,
+    BT_VT_DCS_PARAM,
+    BT_VT_DCS_INTERMEDIATE,
+    BT_VT_DCS_PASSTHROUGH,
+    BT_VT_DCS_IGNORE,
+    BT_VT_OSC_STRING,
+    BT_VT_SOS_PM_APC_STRING,
+    BT_VT_STATE_COUNT
+};
+
+//What a byte does on its way to the next state
+enum {
+    __BT_VT_NONE,
+    __BT_VT_IGNORE,
+    __BT_VT_PRINT,
+    __BT_VT_EXECUTE,
+    __BT_VT_COLLECT,
+    __BT_VT_PARAM,
+    __BT_VT_ESC_DISPATCH,
+    __BT_VT_CSI_DISPATCH,
+    __BT_VT_PUT,
+    __BT_VT_OSC_PUT,
+};
+
+//Table entries: next state in the low 4 bits, action in the next 4, and
+//this bit when the state is left and entered again even if it is the same
+#define __BT_VT_TRANSITION 0x100
+
+//======== Structure Definitions ========//
+
+//Everything the terminal hands back to its owner, any of them may be NULL
+typedef struct {
+    void* user;
+    void (*reply)(void* user, const char* data, size_t len);            //answers to DSR and DA, for the pty
+    void (*title)(void* user, const char* title, size_t len);           //OSC 0 and 2
+    void (*scrolled)(void* user, const bt_cell_t* line, uint32_t cols); //a row left the top of the screen
+    void (*bell)(void* user);
+    void (*dcs)(void* user, uint8_t final, const uint8_t* data, size_t len);
+} bt_vt_callbacks_t;
+
+typedef struct {
+    uint32_t x;
+    uint32_t y;
+    uint16_t attrs;
+    uint8_t fg;
+    uint8_t bg;
+    bool origin;
+} bt_vt_cursor_t;
+
+//Turns the byte stream of a pty into changes to a grid
+typedef struct {
+    dazzle_allocator_t alloc;
+    bt_grid_t* grid;
+    bt_vt_callbacks_t cb;
+
+    //Parser
+    uint8_t state;
+    utf8_dec_state_t utf8;
+    uint32_t params[BT_VT_MAX_PARAMS];
+    uint32_t param_count;
+    uint32_t subparams; //bit i set when params[i] followed a ':'
+    uint8_t intermediates[BT_VT_MAX_INTERMEDIATES];
+    uint32_t intermediate_count;
+    uint8_t dcs_final;
+    uint8_t string[BT_VT_MAX_STRING];
+    uint32_t string_length;
+
+    //Cursor and pen, cells written get attrs, fg and bg
+    bt_vt_cursor_t cursor;
+    bt_vt_cursor_t saved;
+    bool wrap_pending; //the last column was written, the next character goes on a new line
+    uint32_t top;      //scrolling region, inclusive
+    uint32_t bottom;
+    bool autowrap;
+    bool cursor_visible;
+} bt_vt_t;
+
+//======== State Table ========//
+
+static uint16_t __bt_vt_table[BT_VT_STATE_COUNT][256];
+static pthread_once_t __bt_vt_table_once = PTHREAD_ONCE_INIT;
+
+static void __bt_vt_range(uint32_t state, uint32_t lo, uint32_t hi, uint32_t action, uint32_t next){
+    for(uint32_t c = lo; c <= hi; c++) __bt_vt_table[state][c] = action << 4 | next;
+}
+
+//C0 controls other than the ones every state handles the same way
+static void __bt_vt_c0(uint32_t state, uint32_t action){
+    __bt_vt_range(state, 0x00, 0x17, action, state);
+    __bt_vt_range(state, 0x19, 0x19, action, state);
+    __bt_vt_range(state, 0x1C, 0x1F, action, state);
+}
+
+static void __bt_vt_build_table(void){
+    //Bytes from 0x80 up are UTF-8, text in strings and ignored elsewhere
+    for(uint32_t s = 0; s < BT_VT_STATE_COUNT; s++) __bt_vt_range(s, 0x00, 0xFF, __BT_VT_IGNORE, s);
+
+    __bt_vt_c0(BT_VT_GROUND, __BT_VT_EXECUTE);
+    __bt_vt_range(BT_VT_GROUND, 0x20, 0x7E, __BT_VT_PRINT, BT_VT_GROUND);
+
+    __bt_vt_c0(BT_VT_ESCAPE, __BT_VT_EXECUTE);
+    __bt_vt_range(BT_VT_ESCAPE, 0x20, 0x2F, __BT_VT_COLLECT, BT_VT_ESCAPE_INTERMEDIATE);
+    __bt_vt_range(BT_VT_ESCAPE, 0x30, 0x7E, __BT_VT_ESC_DISPATCH, BT_VT_GROUND);
+    __bt_vt_range(BT_VT_ESCAPE, 'P', 'P', __BT_VT_NONE, BT_VT_DCS_ENTRY);
+    __bt_vt_range(BT_VT_ESCAPE, 'X', 'X', __BT_VT_NONE, BT_VT_SOS_PM_APC_STRING);
+    __bt_vt_range(BT_VT_ESCAPE, '[', '[', __BT_VT_NONE, BT_VT_CSI_ENTRY);
+    __bt_vt_range(BT_VT_ESCAPE, ']', ']', __BT_VT_NONE, BT_VT_OSC_STRING);
+    __bt_vt_range(BT_VT_ESCAPE, '^', '_', __BT_VT_NONE, BT_VT_SOS_PM_APC_STRING);
+
+    __bt_vt_c0(BT_VT_ESCAPE_INTERMEDIATE, __BT_VT_EXECUTE);
+    __bt_vt_range(BT_VT_ESCAPE_INTERMEDIATE, 0x20, 0x2F, __BT_VT_COLLECT, BT_VT_ESCAPE_INTERMEDIATE);
+    __bt_vt_range(BT_VT_ESCAPE_INTERMEDIATE, 0x30, 0x7E, __BT_VT_ESC_DISPATCH, BT_VT_GROUND);
+
+    //Colons separate subparameters, like 38:2::r:g:b, instead of spoiling the sequence
+    __bt_vt_c0(BT_VT_CSI_ENTRY, __BT_VT_EXECUTE);
+    __bt_vt_range(BT_VT_CSI_ENTRY, 0x20, 0x2F, __BT_VT_COLLECT, BT_VT_CSI_INTERMEDIATE);
+    __bt_vt_range(BT_VT_CSI_ENTRY, 0x30, 0x3B, __BT_VT_PARAM, BT_VT_CSI_PARAM);
+    __bt_vt_range(BT_VT_CSI_ENTRY, 0x3C, 0x3F, __BT_VT_COLLECT, BT_VT_CSI_PARAM);
+    __bt_vt_range(BT_VT_CSI_ENTRY, 0x40, 0x7E, __BT_VT_CSI_DISPATCH, BT_VT_GROUND);
+
+    __bt_vt_c0(BT_VT_CSI_PARAM, __BT_VT_EXECUTE);
+    __bt_vt_range(BT_VT_CSI_PARAM, 0x20, 0x2F, __BT_VT_COLLECT, BT_VT_CSI_INTERMEDIATE);
+    __bt_vt_range(BT_VT_CSI_PARAM, 0x30, 0x3B, __BT_VT_PARAM, BT_VT_CSI_PARAM);
+    __bt_vt_range(BT_VT_CSI_PARAM, 0x3C, 0x3F, __BT_VT_NONE, BT_VT_CSI_IGNORE);
+    __bt_vt_range(BT_VT_CSI_PARAM, 0x40, 0x7E, __BT_VT_CSI_DISPATCH, BT_VT_GROUND);
+
+    __bt_vt_c0(BT_VT_CSI_INTERMEDIATE, __BT_VT_EXECUTE);
+    __bt_vt_range(BT_VT_CSI_INTERMEDIATE, 0x20, 0x2F, __BT_VT_COLLECT, BT_VT_CSI_INTERMEDIATE);
+    __bt_vt_range(BT_VT_CSI_INTERMEDIATE, 0x30, 0x3F, __BT_VT_NONE, BT_VT_CSI_IGNORE);
+    __bt_vt_range(BT_VT_CSI_INTERMEDIATE, 0x40, 0x7E, __BT_VT_CSI_DISPATCH, BT_VT_GROUND);
+
+    __bt_vt_c0(BT_VT_CSI_IGNORE, __BT_VT_EXECUTE);
+    __bt_vt_range(BT_VT_CSI_IGNORE, 0x40, 0x7E, __BT_VT_NONE, BT_VT_GROUND);
+
+    __bt_vt_range(BT_VT_DCS_ENTRY, 0x20, 0x2F, __BT_VT_COLLECT, BT_VT_DCS_INTERMEDIATE);
+    __bt_vt_range(BT_VT_DCS_ENTRY, 0x30, 0x3B, __BT_VT_PARAM, BT_VT_DCS_PARAM);
+    __bt_vt_range(BT_VT_DCS_ENTRY, 0x3C, 0x3F, __BT_VT_COLLECT, BT_VT_DCS_PARAM);
+    __bt_vt_range(BT_VT_DCS_ENTRY, 0x40, 0x7E, __BT_VT_NONE, BT_VT_DCS_PASSTHROUGH);
+
+    __bt_vt_range(BT_VT_DCS_PARAM, 0x20, 0x2F, __BT_VT_COLLECT, BT_VT_DCS_INTERMEDIATE);
+    __bt_vt_range(BT_VT_DCS_PARAM, 0x30, 0x3B, __BT_VT_PARAM, BT_VT_DCS_PARAM);
+    __bt_vt_range(BT_VT_DCS_PARAM, 0x3C, 0x3F, __BT_VT_NONE, BT_VT_DCS_IGNORE);
+    __bt_vt_range(BT_VT_DCS_PARAM, 0x40, 0x7E, __BT_VT_NONE, BT_VT_DCS_PASSTHROUGH);
+
+    __bt_vt_range(BT_VT_DCS_INTERMEDIATE, 0x20, 0x2F, __BT_VT_COLLECT, BT_VT_DCS_INTERMEDIATE);
+    __bt_vt_range(BT_VT_DCS_INTERMEDIATE, 0x30, 0x3F, __BT_VT_NONE, BT_VT_DCS_IGNORE);
+    __bt_vt_range(BT_VT_DCS_INTERMEDIATE, 0x40, 0x7E, __BT_VT_NONE, BT_VT_DCS_PASSTHROUGH);
+
+    __bt_vt_c0(BT_VT_DCS_PASSTHROUGH, __BT_VT_PUT);
+    __bt_vt_range(BT_VT_DCS_PASSTHROUGH, 0x20, 0x7E, __BT_VT_PUT, BT_VT_DCS_PASSTHROUGH);
+    __bt_vt_range(BT_VT_DCS_PASSTHROUGH, 0x80, 0xFF, __BT_VT_PUT, BT_VT_DCS_PASSTHROUGH);
+
+    //BEL ends an OSC as well as ST does, everything uses that
+    __bt_vt_range(BT_VT_OSC_STRING, 0x07, 0x07, __BT_VT_NONE, BT_VT_GROUND);
+    __bt_vt_range(BT_VT_OSC_STRING, 0x20, 0xFF, __BT_VT_OSC_PUT, BT_VT_OSC_STRING);
+    __bt_vt_range(BT_VT_OSC_STRING, 0x7F, 0x7F, __BT_VT_IGNORE, BT_VT_OSC_STRING);
+
+    //Anywhere
+    for(uint32_t s = 0; s < BT_VT_STATE_COUNT; s++){
+        __bt_vt_table[s][0x18] = __BT_VT_EXECUTE << 4 | BT_VT_GROUND | __BT_VT_TRANSITION;
+        __bt_vt_table[s][0x1A] = __BT_VT_EXECUTE << 4 | BT_VT_GROUND | __BT_VT_TRANSITION;
+        __bt_vt_table[s][0x1B] = __BT_VT_NONE << 4 | BT_VT_ESCAPE | __BT_VT_TRANSITION;
+    }
+}
+
+//======== Cursor Movement ========//
+
+static inline bt_cell_t __bt_vt_blank(const bt_vt_t* vt){
+    return (bt_cell_t){0, 0, BT_DEFAULT_FG, vt->cursor.bg};
+}
+
+static inline uint32_t __bt_vt_param(const bt_vt_t* vt, uint32_t i, uint32_t fallback){
+    return i < vt->param_count && vt->params[i] != 0 ? vt->params[i] : fallback;
+}
+
+static void __bt_vt_goto(bt_vt_t* vt, int64_t x, int64_t y){
+    uint32_t min_y = vt->cursor.origin ? vt->top : 0, max_y = vt->cursor.origin ? vt->bottom : vt->grid->rows - 1;
+    if(x < 0) x = 0;
+    if(x >= vt->grid->cols) x = vt->grid->cols - 1;
+    if(y < min_y) y = min_y;
+    if(y > max_y) y = max_y;
+    vt->cursor.x = (uint32_t)x;
+    vt->cursor.y = (uint32_t)y;
+    vt->wrap_pending = false;
+}
+
+//Moves the region up, the row leaving the top of the screen goes to the scrollback
+static void __bt_vt_scroll_up(bt_vt_t* vt, uint32_t lines){
+    bt_grid_t* grid = vt->grid;
+    if(vt->top == 0 && vt->cb.scrolled != NULL){
+        uint32_t n = lines > vt->bottom + 1 ? vt->bottom + 1 : lines;
+        for(uint32_t i = 0; i < n; i++) vt->cb.scrolled(vt->cb.user, bt_grid_cell(grid, 0, i), grid->cols);
+    }
+    bt_grid_scroll(grid, vt->top, vt->bottom, (int32_t)lines, __bt_vt_blank(vt));
+}
+
+static void __bt_vt_linefeed(bt_vt_t* vt){
+    if(vt->cursor.y == vt->bottom) __bt_vt_scroll_up(vt, 1);
+    else if(vt->cursor.y + 1 < vt->grid->rows) vt->cursor.y++;
+    vt->wrap_pending = false;
+}
+
+//At the bottom margin, a linefeed followed by more lines of plain text scrolls
+//once for all of them: the region moves up by the number of linefeeds coming
+//and the cursor with it, then the lines are written where they end up. The
+//lookahead stops before text that would wrap and after a region's worth of
+//lines, so nothing written here reaches the scrollback.
+static void __bt_vt_jump_scroll(bt_vt_t* vt, const uint8_t* in, size_t len){
+    uint32_t height = vt->bottom - vt->top + 1, x = vt->cursor.x, lines = 0;
+    for(size_t i = 0; i < len && lines < height;){
+        uint8_t c = in[i];
+        if(c == 0x0A || c == 0x0B || c == 0x0C){
+            lines++;
+            i++;
+        } else if(c == 0x0D){
+            x = 0;
+            i++;
+        } else {
+            size_t run = uni_ascii_run(in + i, len - i);
+            if(run == 0 || x + run > vt->grid->cols) break;
+            x += (uint32_t)run;
+            i += run;
+        }
+    }
+    if(lines < 2) return;
+    __bt_vt_scroll_up(vt, lines);
+    vt->cursor.y -= lines;
+    vt->wrap_pending = false;
+}
+
+static void __bt_vt_reverse_linefeed(bt_vt_t* vt){
+    if(vt->cursor.y == vt->top) bt_grid_scroll(vt->grid, vt->top, vt->bottom, -1, __bt_vt_blank(vt));
+    else if(vt->cursor.y > 0) vt->cursor.y--;
+    vt->wrap_pending = false;
+}
+
+//======== Printing ========//
+
+//The next character goes on a new line once the last column was written
+static inline void __bt_vt_wrap(bt_vt_t* vt){
+    if(!vt->wrap_pending || !vt->autowrap) return;
+    vt->wrap_pending = false;
+    vt->cursor.x = 0;
+    __bt_vt_linefeed(vt);
+}
+
+static void __bt_vt_print_ascii(bt_vt_t* vt, const uint8_t* s, size_t count){
+    bt_grid_t* grid = vt->grid;
+    while(count > 0){
+        __bt_vt_wrap(vt);
+        if(vt->wrap_pending){
+            //No autowrap: each character replaces the one in the last column, only the last one stays
+            uint32_t x = grid->cols - 1;
+            bt_grid_write_ascii(grid, &x, vt->cursor.y, s + count - 1, 1, vt->cursor.attrs, vt->cursor.fg, vt->cursor.bg);
+            return;
+        }
+        uint32_t x = vt->cursor.x;
+        uint32_t n = bt_grid_write_ascii(grid, &x, vt->cursor.y, s, count > UINT32_MAX ? UINT32_MAX : (uint32_t)count, vt->cursor.attrs, vt->cursor.fg, vt->cursor.bg);
+        s += n;
+        count -= n;
+        if(x >= grid->cols){
+            vt->cursor.x = grid->cols - 1;
+            vt->wrap_pending = true;
+        } else {
+            vt->cursor.x = x;
+        }
+    }
+}
+
+static void __bt_vt_print(bt_vt_t* vt, const uint32_t* cps, uint32_t count){
+    bt_grid_t* grid = vt->grid;
+    while(count > 0){
+        __bt_vt_wrap(vt);
+        if(vt->wrap_pending){
+            //No autowrap: each character replaces the one in the last column
+            uint32_t x = grid->cols - 1;
+            bt_grid_write(grid, &x, vt->cursor.y, cps + count - 1, 1, vt->cursor.attrs, vt->cursor.fg, vt->cursor.bg);
+            return;
+        }
+        uint32_t x = vt->cursor.x;
+        uint32_t n = bt_grid_write(grid, &x, vt->cursor.y, cps, count, vt->cursor.attrs, vt->cursor.fg, vt->cursor.bg);
+        cps += n;
+        count -= n;
+        if(x >= grid->cols || count > 0){
+            //Full, or a wide character that needs the next line
+            if(n == 0 && vt->cursor.x == 0){
+                cps++;
+                count--;
+                continue;
+            }
+            vt->cursor.x = x >= grid->cols ? grid->cols - 1 : x;
+            vt->wrap_pending = true;
+        } else {
+            vt->cursor.x = x;
+        }
+    }
+}
+
+//======== Control Functions ========//
+
+static void __bt_vt_reply(bt_vt_t* vt, const char* data){
+    if(vt->cb.reply != NULL) vt->cb.reply(vt->cb.user, data, strlen(data));
+}
+
+static void __bt_vt_execute(bt_vt_t* vt, uint8_t c){
+    switch(c){
+        case 0x07:
+            if(vt->cb.bell != NULL) vt->cb.bell(vt->cb.user);
+            break;
+        case 0x08:
+            if(vt->cursor.x > 0) vt->cursor.x--;
+            vt->wrap_pending = false;
+            break;
+        case 0x09: {
+            uint32_t x = (vt->cursor.x / BT_VT_TAB_WIDTH + 1) * BT_VT_TAB_WIDTH;
+            vt->cursor.x = x >= vt->grid->cols ? vt->grid->cols - 1 : x;
+            break;
+        }
+        case 0x0A: case 0x0B: case 0x0C:
+            __bt_vt_linefeed(vt);
+            break;
+        case 0x0D:
+            vt->cursor.x = 0;
+            vt->wrap_pending = false;
+            break;
+    }
+}
+
+//Closest palette entry to a direct color, cells only hold indices
+static uint8_t __bt_vt_nearest(uint32_t r, uint32_t g, uint32_t b){
+    #define __BT_CUBE(v) ((v) < 48 ? 0 : (v) < 115 ? 1 : ((v) - 35) / 40)
+    uint32_t cr = __BT_CUBE(r), cg = __BT_CUBE(g), cb = __BT_CUBE(b);
+    #undef __BT_CUBE
+    uint32_t vr = cr ? cr * 40 + 55 : 0, vg = cg ? cg * 40 + 55 : 0, vb = cb ? cb * 40 + 55 : 0;
+
+    //Grays are finer than the cube's diagonal
+    uint32_t avg = (r + g + b) / 3, gray = avg > 238 ? 23 : avg < 8 ? 0 : (avg - 3) / 10, vgray = gray * 10 + 8;
+    int32_t dc = (int32_t)(vr - r) * (int32_t)(vr - r) + (int32_t)(vg - g) * (int32_t)(vg - g) + (int32_t)(vb - b) * (int32_t)(vb - b);
+    int32_t dg = (int32_t)(vgray - r) * (int32_t)(vgray - r) + (int32_t)(vgray - g) * (int32_t)(vgray - g) + (int32_t)(vgray - b) * (int32_t)(vgray - b);
+    return dg < dc ? 232 + gray : 16 + cr * 36 + cg * 6 + cb;
+}
+
+//38 and 48: 5;n picks a palette entry, 2;r;g;b a direct color. Returns how many params it used.
+static uint32_t __bt_vt_extended_color(bt_vt_t* vt, uint32_t i, uint8_t* color){
+    if(i + 1 >= vt->param_count) return 0;
+    //The colon form may carry a color space id before r:g:b
+    bool colon = (vt->subparams >> (i + 1)) & 1;
+    if(vt->params[i + 1] == 5 && i + 2 < vt->param_count){
+        *color = vt->params[i + 2] > 255 ? 255 : vt->params[i + 2];
+        return 2;
+    }
+    if(vt->params[i + 1] == 2){
+        uint32_t first = i + 2;
+        if(colon && i + 5 < vt->param_count && ((vt->subparams >> (i + 5)) & 1)) first++;
+        if(first + 2 >= vt->param_count) return vt->param_count - i - 1;
+        uint32_t r = vt->params[first], g = vt->params[first + 1], b = vt->params[first + 2];
+        *color = __bt_vt_nearest(r > 255 ? 255 : r, g > 255 ? 255 : g, b > 255 ? 255 : b);
+        return first + 2 - i;
+    }
+    return 1;
+}
+
+static void __bt_vt_sgr(bt_vt_t* vt){
+    bt_vt_cursor_t* c = &vt->cursor;
+    if(vt->param_count == 0){
+        c->attrs = 0;
+        c->fg = BT_DEFAULT_FG;
+        c->bg = BT_DEFAULT_BG;
+        return;
+    }
+    for(uint32_t i = 0; i < vt->param_count; i++){
+        uint32_t p = vt->params[i];
+        if(p >= 30 && p <= 37) c->fg = p - 30;
+        else if(p >= 40 && p <= 47) c->bg = p - 40;
+        else if(p >= 90 && p <= 97) c->fg = p - 90 + 8;
+        else if(p >= 100 && p <= 107) c->bg = p - 100 + 8;
+        else switch(p){
+            case 0: c->attrs = 0; c->fg = BT_DEFAULT_FG; c->bg = BT_DEFAULT_BG; break;
+            case 1: c->attrs |= BT_ATTR_BOLD; break;
+            case 2: c->attrs |= BT_ATTR_DIM; break;
+            case 3: c->attrs |= BT_ATTR_ITALIC; break;
+            case 4: c->attrs |= BT_ATTR_UNDERLINE; break;
+            case 5: case 6: c->attrs |= BT_ATTR_BLINK; break;
+            case 7: c->attrs |= BT_ATTR_REVERSE; break;
+            case 8: c->attrs |= BT_ATTR_INVISIBLE; break;
+            case 9: c->attrs |= BT_ATTR_STRIKE; break;
+            case 21: c->attrs |= BT_ATTR_UNDERLINE; break;
+            case 22: c->attrs &= ~(BT_ATTR_BOLD | BT_ATTR_DIM); break;
+            case 23: c->attrs &= ~BT_ATTR_ITALIC; break;
+            case 24: c->attrs &= ~BT_ATTR_UNDERLINE; break;
+            case 25: c->attrs &= ~BT_ATTR_BLINK; break;
+            case 27: c->attrs &= ~BT_ATTR_REVERSE; break;
+            case 28: c->attrs &= ~BT_ATTR_INVISIBLE; break;
+            case 29: c->attrs &= ~BT_ATTR_STRIKE; break;
+            case 38: i += __bt_vt_extended_color(vt, i, &c->fg); break;
+            case 48: i += __bt_vt_extended_color(vt, i, &c->bg); break;
+            case 39: c->fg = BT_DEFAULT_FG; break;
+            case 49: c->bg = BT_DEFAULT_BG; break;
+        }
+    }
+}
+
+static void __bt_vt_erase(bt_vt_t* vt, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1){
+    //From (x0, y0) up to but not including (x1, y1), row by row
+    for(uint32_t y = y0; y <= y1 && y < vt->grid->rows; y++){
+        uint32_t from = y == y0 ? x0 : 0, to = y == y1 ? x1 : vt->grid->cols;
+        if(to > from) bt_grid_fill(vt->grid, from, y, to - from, __bt_vt_blank(vt));
+    }
+}
+
+static void __bt_vt_mode(bt_vt_t* vt, bool set){
+    if(vt->intermediate_count != 1 || vt->intermediates[0] != '?') return;
+    for(uint32_t i = 0; i < vt->param_count; i++){
+        switch(vt->params[i]){
+            case 6:
+                vt->cursor.origin = set;
+                __bt_vt_goto(vt, 0, set ? vt->top : 0);
+                break;
+            case 7: vt->autowrap = set; break;
+            case 25: vt->cursor_visible = set; break;
+        }
+    }
+}
+
+//Blanks a wide character whose halves are on both sides of col, before the row is cut there
+static void __bt_vt_split_wide(bt_vt_t* vt, uint32_t col, uint32_t y){
+    bt_grid_t* grid = vt->grid;
+    if(col == 0 || col >= grid->cols || !(bt_grid_cell(grid, col, y)->attrs & BT_ATTR_WIDE_CONT)) return;
+    bt_grid_set(grid, col - 1, y, __bt_vt_blank(vt));
+    bt_grid_set(grid, col, y, __bt_vt_blank(vt));
+}
+
+//Shifts the rest of the row right (insert) or left (delete) from the cursor
+static void __bt_vt_shift_row(bt_vt_t* vt, uint32_t n, bool insert){
+    bt_grid_t* grid = vt->grid;
+    uint32_t x = vt->cursor.x, y = vt->cursor.y, cols = grid->cols;
+    if(n > cols - x) n = cols - x;
+    //Wide characters cut by the cursor, or by the cells pushed off or deleted, would lose a half
+    __bt_vt_split_wide(vt, x, y);
+    __bt_vt_split_wide(vt, insert ? cols - n : x + n, y);
+    if(insert){
+        for(uint32_t c = cols - 1; c >= x + n && c != UINT32_MAX; c--) bt_grid_set(grid, c, y, *bt_grid_cell(grid, c - n, y));
+        bt_grid_fill(grid, x, y, n, __bt_vt_blank(vt));
+    } else {
+        for(uint32_t c = x; c + n < cols; c++) bt_grid_set(grid, c, y, *bt_grid_cell(grid, c + n, y));
+        bt_grid_fill(grid, cols - n, y, n, __bt_vt_blank(vt));
+    }
+    vt->wrap_pending = false;
+}
+
+static void __bt_vt_csi(bt_vt_t* vt, uint8_t final){
+    bt_vt_cursor_t* c = &vt->cursor;
+    bt_grid_t* grid = vt->grid;
+    bool private = vt->intermediate_count > 0;
+    uint32_t n = __bt_vt_param(vt, 0, 1);
+
+    if(private && final != 'h' && final != 'l'){
+        //DA2 is the only private query worth answering
+        if(final == 'c' && vt->intermediates[0] == '>') __bt_vt_reply(vt, "\x1b[>0;0;0c");
+        return;
+    }
+
+    switch(final){
+        case 'A': __bt_vt_goto(vt, c->x, (int64_t)c->y - n); break;
+        case 'B': case 'e': __bt_vt_goto(vt, c->x, (int64_t)c->y + n); break;
+        case 'C': case 'a': __bt_vt_goto(vt, (int64_t)c->x + n, c->y); break;
+        case 'D': __bt_vt_goto(vt, (int64_t)c->x - n, c->y); break;
+        case 'E': __bt_vt_goto(vt, 0, (int64_t)c->y + n); break;
+        case 'F': __bt_vt_goto(vt, 0, (int64_t)c->y - n); break;
+        case 'G': case '`': __bt_vt_goto(vt, (int64_t)n - 1, c->y); break;
+        case 'd': __bt_vt_goto(vt, c->x, (int64_t)n - 1 + (c->origin ? vt->top : 0)); break;
+        case 'H': case 'f':
+            __bt_vt_goto(vt, (int64_t)__bt_vt_param(vt, 1, 1) - 1, (int64_t)n - 1 + (c->origin ? vt->top : 0));
+            break;
+        case 'J':
+            switch(__bt_vt_param(vt, 0, 0)){
+                case 0: __bt_vt_erase(vt, c->x, c->y, grid->cols, grid->rows - 1); break;
+                case 1: __bt_vt_erase(vt, 0, 0, c->x + 1, c->y); break;
+                case 2: case 3: __bt_vt_erase(vt, 0, 0, grid->cols, grid->rows - 1); break;
+            }
+            vt->wrap_pending = false;
+            break;
+        case 'K':
+            switch(__bt_vt_param(vt, 0, 0)){
+                case 0: __bt_vt_erase(vt, c->x, c->y, grid->cols, c->y); break;
+                case 1: __bt_vt_erase(vt, 0, c->y, c->x + 1, c->y); break;
+                case 2: __bt_vt_erase(vt, 0, c->y, grid->cols, c->y); break;
+            }
+            vt->wrap_pending = false;
+            break;
+        case 'X':
+            bt_grid_fill(grid, c->x, c->y, n, __bt_vt_blank(vt));
+            vt->wrap_pending = false;
+            break;
+        case '@': __bt_vt_shift_row(vt, n, true); break;
+        case 'P': __bt_vt_shift_row(vt, n, false); break;
+        case 'L': case 'M':
+            if(c->y >= vt->top && c->y <= vt->bottom){
+                bt_grid_scroll(grid, c->y, vt->bottom, final == 'L' ? -(int32_t)n : (int32_t)n, __bt_vt_blank(vt));
+                c->x = 0;
+                vt->wrap_pending = false;
+            }
+            break;
+        case 'S': __bt_vt_scroll_up(vt, n); break;
+        case 'T': bt_grid_scroll(grid, vt->top, vt->bottom, -(int32_t)n, __bt_vt_blank(vt)); break;
+        case 'b': {
+            //Repeats the character left of the cursor
+            uint32_t cp = c->x > 0 ? bt_grid_cell(grid, c->x - 1, c->y)->codepoint : 0;
+            for(uint32_t i = 0; cp != 0 && i < n && i < grid->cols * grid->rows; i++) __bt_vt_print(vt, &cp, 1);
+            break;
+        }
+        case 'm': __bt_vt_sgr(vt); break;
+        case 'r': {
+            uint32_t top = __bt_vt_param(vt, 0, 1) - 1, bottom = __bt_vt_param(vt, 1, grid->rows) - 1;
+            if(bottom >= grid->rows) bottom = grid->rows - 1;
+            if(top < bottom){
+                vt->top = top;
+                vt->bottom = bottom;
+                __bt_vt_goto(vt, 0, c->origin ? top : 0);
+            }
+            break;
+        }
+        case 's': vt->saved = *c; break;
+        case 'u': *c = vt->saved; vt->wrap_pending = false; break;
+        case 'h': __bt_vt_mode(vt, true); break;
+        case 'l': __bt_vt_mode(vt, false); break;
+        case 'n':
+            if(n == 5) __bt_vt_reply(vt, "\x1b[0n");
+            else if(n == 6){
+                char report[32];
+                snprintf(report, sizeof(report), "\x1b[%u;%uR", c->y + 1 - (c->origin ? vt->top : 0), c->x + 1);
+                __bt_vt_reply(vt, report);
+            }
+            break;
+        case 'c':
+            if(__bt_vt_param(vt, 0, 0) == 0) __bt_vt_reply(vt, "\x1b[?62;22c");
+            break;
+    }
+}
+
+static void __bt_vt_esc(bt_vt_t* vt, uint8_t final){
+    //Character set designations and the like carry intermediates, none of them matter for UTF-8
+    if(vt->intermediate_count > 0) return;
+    switch(final){
+        case '7': vt->saved = vt->cursor; break;
+        case '8': vt->cursor = vt->saved; vt->wrap_pending = false; break;
+        case 'D': __bt_vt_linefeed(vt); break;
+        case 'E': vt->cursor.x = 0; __bt_vt_linefeed(vt); break;
+        case 'M': __bt_vt_reverse_linefeed(vt); break;
+        case 'c':
+            vt->cursor = vt->saved = (bt_vt_cursor_t){0, 0, 0, BT_DEFAULT_FG, BT_DEFAULT_BG, false};
+            vt->top = 0;
+            vt->bottom = vt->grid->rows - 1;
+            vt->autowrap = vt->cursor_visible = true;
+            vt->wrap_pending = false;
+            __bt_vt_erase(vt, 0, 0, vt->grid->cols, vt->grid->rows - 1);
+            break;
+    }
+}
+
+static void __bt_vt_osc_end(bt_vt_t* vt){
+    //Only the title is understood, "0;title" or "2;title"
+    const uint8_t* s = vt->string;
+    uint32_t len = vt->string_length;
+    if(len >= 2 && (s[0] == '0' || s[0] == '2') && s[1] == ';' && vt->cb.title != NULL)
+        vt->cb.title(vt->cb.user, (const char*)s + 2, len - 2);
+}
+
+//======== Parser ========//
+
+static inline void __bt_vt_clear(bt_vt_t* vt){
+    vt->param_count = 0;
+    vt->subparams = 0;
+    vt->intermediate_count = 0;
+}
+
+static void __bt_vt_action(bt_vt_t* vt, uint32_t action, uint8_t c){
+    switch(action){
+        case __BT_VT_PRINT: __bt_vt_print_ascii(vt, &c, 1); break;
+        case __BT_VT_EXECUTE: __bt_vt_execute(vt, c); break;
+        case __BT_VT_COLLECT:
+            if(vt->intermediate_count < BT_VT_MAX_INTERMEDIATES) vt->intermediates[vt->intermediate_count] = c;
+            vt->intermediate_count++;
+            break;
+        case __BT_VT_PARAM:
+            if(vt->param_count == 0){
+                vt->params[0] = 0;
+                vt->param_count = 1;
+            }
+            if(c == ';' || c == ':'){
+                if(vt->param_count < BT_VT_MAX_PARAMS){
+                    if(c == ':') vt->subparams |= 1u << vt->param_count;
+                    vt->params[vt->param_count++] = 0;
+                }
+            } else {
+                uint32_t* p = &vt->params[vt->param_count - 1];
+                *p = *p >= 100000 ? *p : *p * 10 + (c - '0');
+            }
+            break;
+        case __BT_VT_ESC_DISPATCH:
+            if(vt->intermediate_count <= BT_VT_MAX_INTERMEDIATES) __bt_vt_esc(vt, c);
+            break;
+        case __BT_VT_CSI_DISPATCH:
+            if(vt->intermediate_count <= BT_VT_MAX_INTERMEDIATES) __bt_vt_csi(vt, c);
+            break;
+        case __BT_VT_PUT: case __BT_VT_OSC_PUT:
+            if(vt->string_length < BT_VT_MAX_STRING) vt->string[vt->string_length++] = c;
+            break;
+    }
+}
+
+//Exit action of the state being left and entry action of the next one
+static void __bt_vt_exit(bt_vt_t* vt, uint32_t state){
+    if(state == BT_VT_OSC_STRING) __bt_vt_osc_end(vt);
+    else if(state == BT_VT_DCS_PASSTHROUGH && vt->cb.dcs != NULL) vt->cb.dcs(vt->cb.user, vt->dcs_final, vt->string, vt->string_length);
+}
+
+static void __bt_vt_enter(bt_vt_t* vt, uint32_t state, uint8_t c){
+    if(state == BT_VT_ESCAPE || state == BT_VT_CSI_ENTRY || state == BT_VT_DCS_ENTRY) __bt_vt_clear(vt);
+    else if(state == BT_VT_OSC_STRING) vt->string_length = 0;
+    else if(state == BT_VT_DCS_PASSTHROUGH){
+        vt->dcs_final = c;
+        vt->string_length = 0;
+    }
+}
+
+//Ground state text up to the next control, straight into the grid. Returns the bytes used.
+static size_t __bt_vt_text(bt_vt_t* vt, const uint8_t* in, size_t len){
+    size_t i = 0;
+    while(i < len){
+        if(vt->utf8.bytes_remaining == 0){
+            size_t run = uni_ascii_run(in + i, len - i);
+            if(run > 0){
+                __bt_vt_print_ascii(vt, in + i, run);
+                i += run;
+                continue;
+            }
+            if(in[i] < 0x80) break;
+        }
+
+        //Everything up to the next ascii byte is decoded in bulk
+        size_t end = i;
+        while(end < len && in[end] >= 0x80) end++;
+        while(i < end){
+            uint32_t cps[256];
+            size_t used;
+            uint32_t n = utf8_decode_buf(&vt->utf8, in + i, end - i, cps, 256, &used);
+            __bt_vt_print(vt, cps, n);
+            i += used;
+        }
+        //Cut short by the ascii byte after it, a sequence split between feeds waits for the rest
+        if(vt->utf8.bytes_remaining != 0 && i < len){
+            uint32_t replacement = UTF8_REPLACEMENT_CHARACTER;
+            vt->utf8 = (utf8_dec_state_t){0, 0, 0};
+            __bt_vt_print(vt, &replacement, 1);
+        }
+    }
+    return i;
+}
+
+//======== Functions ========//
+
+/*
+ * @brief Creates a terminal writing into a grid
+ *
+ * @param alloc The allocator to use
+ * @param grid The grid, owned by the caller and kept for the terminal's lifetime
+ * @param callbacks Where replies, titles and scrolled out rows go, may be NULL
+ * @return bt_vt_t* The terminal, or NULL on failure
+*/
+bt_vt_t* bt_vt_create(dazzle_allocator_t alloc, bt_grid_t* grid, const bt_vt_callbacks_t* callbacks){
+    if(grid == NULL) return NULL;
+    pthread_once(&__bt_vt_table_once, __bt_vt_build_table);
+
+    bt_vt_t* vt = alloc.malloc(sizeof(bt_vt_t));
+    if(vt == NULL) return NULL;
+    memset(vt, 0, sizeof(bt_vt_t));
+    vt->alloc = alloc;
+    vt->grid = grid;
+    if(callbacks != NULL) vt->cb = *callbacks;
+    vt->cursor = vt->saved = (bt_vt_cursor_t){0, 0, 0, BT_DEFAULT_FG, BT_DEFAULT_BG, false};
+    vt->bottom = grid->rows - 1;
+    vt->autowrap = true;
+    vt->cursor_visible = true;
+    return vt;
+}
+
+/*
+ * @brief Feeds bytes from the pty, sequences may be split anywhere between calls
+ *
+ * Text in the ground state skips the state table: runs of printable ascii are
+ * found 16 bytes at a time and written to the grid in one go.
+ * Lines of it arriving at the bottom margin scroll the screen once per batch.
+ *
+ * @param vt The terminal
+ * @param data The bytes
+ * @param len How many there are
+*/
+void bt_vt_feed(bt_vt_t* vt, const uint8_t* data, size_t len){
+    DAZZLE_TRACE_SCOPE("bt_vt_feed");
+    size_t i = 0;
+    while(i < len){
+        if(vt->state == BT_VT_GROUND && (vt->utf8.bytes_remaining != 0 || (data[i] >= 0x20 && data[i] != 0x7F))){
+            i += __bt_vt_text(vt, data + i, len - i);
+            continue;
+        }
+
+        if(vt->state == BT_VT_GROUND && data[i] >= 0x0A && data[i] <= 0x0C && vt->cursor.y == vt->bottom)
+            __bt_vt_jump_scroll(vt, data + i, len - i);
+
+        uint8_t c = data[i++];
+        uint16_t entry = __bt_vt_table[vt->state][c];
+        uint32_t next = entry & 0x0F, action = entry >> 4 & 0x0F;
+        if(next != vt->state || (entry & __BT_VT_TRANSITION)){
+            __bt_vt_exit(vt, vt->state);
+            __bt_vt_action(vt, action, c);
+            vt->state = next;
+            __bt_vt_enter(vt, next, c);
+        } else {
+            __bt_vt_action(vt, action, c);
+        }
+    }
+}
+
+/*
+ * @brief Frees a terminal, the grid stays
+ *
+ * @param vt The terminal
+*/
+void bt_vt_destroy(bt_vt_t* vt){
+    if(vt == NULL) return;
+    vt->alloc.free(vt);
+}
+
+#endif // __BT_VT_H__
@@ -0,0 +1,475 @@
+ #ifndef __DRM_INC_C__
+ #define __DRM_INC_C__
+
+ #include <errno.h>
+ #include <poll.h>
+ #include <pthread.h>
+ #include <stdatomic.h>
+ #include <sys/mman.h>
+ #include <xf86drm.h>
+ #include <xf86drmMode.h>
+
+ //======== Defines ========//
+ #define DAZZLE_DRM_MAX_BUFFERS 3
+ #define DAZZLE_DRM_MAX_DAMAGE 16
+
+ //======== Structure Definitions ========//
+ typedef struct
+ {
+     uint32_t handle;
+     uint32_t pitch;
+     uint64_t size;
+     uint32_t fb_id;
+     uint8_t *map;
+
+     // Regions that changed since this buffer was last drawn into
+     uint32_t stale_count;
+     dazzle_rect_t stale[DAZZLE_DRM_MAX_DAMAGE];
+ } dazzle_drm_buffer_t;
+
+ typedef struct
+ {
+     // Has to stay first, the framebuffer paths render through it//
+     dazzle_framebuffer_t fb;
+
+     // Device//
+     int fd;
+     uint32_t crtc_id;
+     uint32_t connector_id;
+     drmModeModeInfo mode;
+     drmModeCrtc *saved_crtc;
+
+     // Buffers//
+     uint32_t buffer_count;
+     dazzle_drm_buffer_t buffers[DAZZLE_DRM_MAX_BUFFERS];
+     uint32_t back;    // being drawn into
+     uint32_t front;   // last one handed to the display
+     _Atomic uint32_t scanout; // the one the display is actually reading, set by the flip handler
+     uint32_t flipping; // the one a pending flip will show
+
+     // Frame state//
+     bool modeset;
+     _Atomic bool flip_pending; // cleared by whichever thread reads the flip event
+     bool frame_started;
+     uint32_t damage_count;
+     dazzle_rect_t damage[DAZZLE_DRM_MAX_DAMAGE];
+ } dazzle_drm_t;
+
+ //======== Function Prototypes ========//
+
+ /*
+  * dazzle_init_drm(alloc,fd,connector_id,crtc_id,mode,buffer_count) -> dazzle_context_t*
+  * Initializes a new Dazzle renderer on a KMS CRTC, owning buffer_count (2 or 3)
+  * dumb buffers. Nothing is shown until the first dazzle_drm_present.
+  */
+ dazzle_context_t *dazzle_init_drm(dazzle_allocator_t alloc, int fd, uint32_t connector_id, uint32_t crtc_id, drmModeModeInfo *mode, uint32_t buffer_count);
+
+ /*
+  * dazzle_drm_present(ctx) -> bool
+  * Queues the frame drawn since the last present for the next vblank. Blocks only
+  * when no free buffer is left to draw the next frame into.
+  */
+ bool dazzle_drm_present(dazzle_context_t *ctx);
+
+ /*
+  * dazzle_drm_destroy(ctx)
+  * Waits for outstanding flips, restores the previous CRTC state and frees the buffers
+  */
+ void dazzle_drm_destroy(dazzle_context_t *ctx);
+
+ //======== Function Implementations ========//
+ #ifdef __DAZZLE_IMPL__
+
+ static void __drm_add_damage(dazzle_rect_t *list, uint32_t *count, const dazzle_rect_t *r)
+ {
+     if (*count < DAZZLE_DRM_MAX_DAMAGE)
+     {
+         list[(*count)++] = *r;
+         return;
+     }
+
+     // Out of slots, collapse everything into one bounding box
+     for (uint32_t i = 1; i < *count; i++)
+         dazzle_rect_union(&list[0], &list[i]);
+     dazzle_rect_union(&list[0], r);
+     *count = 1;
+ }
+
+ static bool __drm_clip(dazzle_drm_t *drm, dazzle_rect_t *r)
+ {
+     if (r->x >= drm->fb.width || r->y >= drm->fb.height)
+         return false;
+     if (r->width > drm->fb.width - r->x)
+         r->width = drm->fb.width - r->x;
+     if (r->height > drm->fb.height - r->y)
+         r->height = drm->fb.height - r->y;
+     return r->width != 0 && r->height != 0;
+ }
+
+ // Outputs rendered on separate threads share the fd, and any of them may read
+ // another one's flip event. One thread at a time reads and dispatches events,
+ // the others sleep until it did and check whether their flip was among them.
+ static pthread_mutex_t __drm_event_lock = PTHREAD_MUTEX_INITIALIZER;
+ static pthread_cond_t __drm_event_cond = PTHREAD_COND_INITIALIZER;
+ static bool __drm_event_reader = false;
+
+ static void __drm_page_flip_handler(int fd, unsigned int sequence, unsigned int tv_sec, unsigned int tv_usec, void *data)
+ {
+     dazzle_drm_t *drm = (dazzle_drm_t *)data;
+     atomic_store_explicit(&drm->scanout, drm->flipping, memory_order_relaxed);
+     atomic_store_explicit(&drm->flip_pending, false, memory_order_release);
+ }
+
+ static bool __drm_wait_flip(dazzle_drm_t *drm)
+ {
+     drmEventContext ev = {0};
+     ev.version = 2;
+     ev.page_flip_handler = __drm_page_flip_handler;
+
+     struct pollfd pfd = {drm->fd, POLLIN, 0};
+     bool ok = true;
+
+     pthread_mutex_lock(&__drm_event_lock);
+     while (ok && atomic_load_explicit(&drm->flip_pending, memory_order_acquire))
+     {
+         if (__drm_event_reader)
+         {
+             pthread_cond_wait(&__drm_event_cond, &__drm_event_lock);
+             continue;
+         }
+
+         __drm_event_reader = true;
+         pthread_mutex_unlock(&__drm_event_lock);
+
+         // Bounded, so waiters on other fds get their turn at reading
+         int ready = poll(&pfd, 1, 16);
+         if (ready < 0 && errno != EINTR)
+             ok = false;
+         else if (ready > 0 && drmHandleEvent(drm->fd, &ev) != 0)
+             ok = false;
+
+         pthread_mutex_lock(&__drm_event_lock);
+         __drm_event_reader = false;
+         pthread_cond_broadcast(&__drm_event_cond);
+     }
+     pthread_mutex_unlock(&__drm_event_lock);
+     return ok;
+ }
+
+ // Makes the back buffer drawable and brings it up to date with the front one.
+ // A full-screen operation overwrites everything anyway, so it skips the copy.
+ static bool __drm_begin_frame(dazzle_context_t *ctx, dazzle_drm_t *drm, bool full)
+ {
+     if (drm->frame_started)
+         return true;
+
+     // With two buffers the next back buffer is still on screen until the flip lands
+     if (atomic_load_explicit(&drm->flip_pending, memory_order_acquire) && drm->back == atomic_load_explicit(&drm->scanout, memory_order_relaxed) && !__drm_wait_flip(drm))
+         return false;
+
+     dazzle_drm_buffer_t *back = &drm->buffers[drm->back];
+     dazzle_drm_buffer_t *front = &drm->buffers[drm->front];
+     uint32_t bypp = drm->fb.bpp / 8;
+
+     if (!full && back != front)
+     {
+         for (uint32_t i = 0; i < back->stale_count; i++)
+         {
+             dazzle_rect_t *r = &back->stale[i];
+             __DAZZLE_STAT(ctx, bytes_copied, (uint64_t)r->width * r->height * bypp);
+             for (uint32_t y = r->y; y < r->y + r->height; y++)
+             {
+                 memcpy(back->map + (size_t)y * back->pitch + (size_t)r->x * bypp,
+                        front->map + (size_t)y * front->pitch + (size_t)r->x * bypp,
+                        (size_t)r->width * bypp);
+             }
+         }
+     }
+     back->stale_count = 0;
+
+     drm->fb.address = (uintptr_t)back->map;
+     drm->fb.pitch = back->pitch;
+     drm->frame_started = true;
+     return true;
+ }
+
+ // Starts the frame if needed and records (x,y,width,height) as damaged
+ static bool __drm_touch(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+ {
+     dazzle_drm_t *drm = (dazzle_drm_t *)ctx->renderer_data;
+     if (drm == NULL || !__drm_begin_frame(ctx, drm, false))
+         return false;
+
+     dazzle_rect_t r = {x, y, width, height};
+     if (__drm_clip(drm, &r))
+         __drm_add_damage(drm->damage, &drm->damage_count, &r);
+     return true;
+ }
+
+ bool dazzle_drm_fill_span(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint64_t color)
+ {
+     if (!__drm_touch(ctx, x, y, width, 1))
+         return false;
+     return dazzle_fb_fill_span(ctx, x, y, width, color);
+ }
+
+ bool dazzle_drm_fill_rect(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint64_t color)
+ {
+     if (!__drm_touch(ctx, x, y, width, height))
+         return false;
+     return dazzle_fb_fill_rect(ctx, x, y, width, height, color);
+ }
+
+ bool dazzle_drm_copy_rect(dazzle_context_t *ctx, uint32_t dst_x, uint32_t dst_y, uint32_t src_x, uint32_t src_y, uint32_t width, uint32_t height)
+ {
+     if (!__drm_touch(ctx, dst_x, dst_y, width, height))
+         return false;
+     return dazzle_fb_copy_rect(ctx, dst_x, dst_y, src_x, src_y, width, height);
+ }
+
+ bool dazzle_drm_blit(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void *pixels, uint32_t stride)
+ {
+     if (!__drm_touch(ctx, x, y, width, height))
+         return false;
+     return dazzle_fb_blit(ctx, x, y, width, height, pixels, stride);
+ }
+
+ bool dazzle_drm_blend(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint32_t *pixels, uint32_t stride)
+ {
+     if (!__drm_touch(ctx, x, y, width, height))
+         return false;
+     return dazzle_fb_blend(ctx, x, y, width, height, pixels, stride);
+ }
+
+ bool dazzle_drm_draw_mono(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t *bits, uint32_t stride, uint64_t fg, uint64_t bg)
+ {
+     if (!__drm_touch(ctx, x, y, width, height))
+         return false;
+     return dazzle_fb_draw_mono(ctx, x, y, width, height, bits, stride, fg, bg);
+ }
+
+ bool dazzle_drm_draw_alpha(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t *alpha, uint32_t stride, uint64_t color)
+ {
+     if (!__drm_touch(ctx, x, y, width, height))
+         return false;
+     return dazzle_fb_draw_alpha(ctx, x, y, width, height, alpha, stride, color);
+ }
+
+ // Reads what was last presented, not the frame being drawn
+ bool dazzle_drm_read_rect(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, void *pixels, uint32_t stride)
+ {
+     dazzle_drm_t *drm = (dazzle_drm_t *)ctx->renderer_data;
+     dazzle_rect_t r = {x, y, width, height};
+     if (drm == NULL || pixels == NULL || !__drm_clip(drm, &r))
+         return false;
+
+     dazzle_drm_buffer_t *front = &drm->buffers[drm->front];
+     uint32_t bypp = drm->fb.bpp / 8;
+     uint8_t *dst = (uint8_t *)pixels;
+     __DAZZLE_STAT(ctx, bytes_copied, (uint64_t)r.width * r.height * bypp);
+     for (uint32_t i = 0; i < r.height; i++, dst += stride)
+         memcpy(dst, front->map + (size_t)(r.y + i) * front->pitch + (size_t)r.x * bypp, (size_t)r.width * bypp);
+     return true;
+ }
+
+ bool dazzle_drm_clear(dazzle_context_t *ctx, uint64_t color)
+ {
+     dazzle_drm_t *drm = (dazzle_drm_t *)ctx->renderer_data;
+     if (drm == NULL || !__drm_begin_frame(ctx, drm, true))
+         return false;
+
+     dazzle_rect_t all = {0, 0, drm->fb.width, drm->fb.height};
+     drm->damage_count = 0;
+     __drm_add_damage(drm->damage, &drm->damage_count, &all);
+
+     return dazzle_fb_clear(ctx, color);
+ }
+
+ bool dazzle_drm_draw_element(dazzle_context_t *ctx, dazzle_retained_element_t *e)
+ {
+     dazzle_drm_t *drm = (dazzle_drm_t *)ctx->renderer_data;
+     if (drm == NULL || !__drm_begin_frame(ctx, drm, false))
+         return false;
+
+     dazzle_rect_t r;
+     if (dazzle_element_bounds(e, &r) && __drm_clip(drm, &r))
+         __drm_add_damage(drm->damage, &drm->damage_count, &r);
+
+     return dazzle_fb_draw_element(ctx, e);
+ }
+
+ bool dazzle_drm_present(dazzle_context_t *ctx)
+ {
+     DAZZLE_TRACE_SCOPE("drm_present");
+     dazzle_drm_t *drm = (dazzle_drm_t *)ctx->renderer_data;
+     if (drm == NULL)
+         return false;
+     if (!drm->frame_started)
+         return true; // nothing new to show
+
+     // Only one flip can be queued per CRTC
+     if (atomic_load_explicit(&drm->flip_pending, memory_order_acquire) && !__drm_wait_flip(drm))
+         return false;
+
+     dazzle_drm_buffer_t *back = &drm->buffers[drm->back];
+     if (!drm->modeset)
+     {
+         if (drmModeSetCrtc(drm->fd, drm->crtc_id, back->fb_id, 0, 0, &drm->connector_id, 1, &drm->mode))
+             return false;
+         drm->modeset = true;
+         atomic_store_explicit(&drm->scanout, drm->back, memory_order_relaxed);
+     }
+     else
+     {
+         drm->flipping = drm->back;
+         if (drmModePageFlip(drm->fd, drm->crtc_id, back->fb_id, DRM_MODE_PAGE_FLIP_EVENT, drm))
+             return false;
+         atomic_store_explicit(&drm->flip_pending, true, memory_order_relaxed);
+     }
+
+     // Every other buffer is now missing this frame's damage
+     for (uint32_t i = 0; i < drm->buffer_count; i++)
+     {
+         if (i == drm->back)
+             continue;
+         for (uint32_t j = 0; j < drm->damage_count; j++)
+             __drm_add_damage(drm->buffers[i].stale, &drm->buffers[i].stale_count, &drm->damage[j]);
+     }
+
+     drm->front = drm->back;
+     drm->back = (drm->back + 1) % drm->buffer_count;
+     drm->damage_count = 0;
+     drm->frame_started = false;
+     return true;
+ }
+
+ static void __drm_free_buffer(int fd, dazzle_drm_buffer_t *b)
+ {
+     if (b->map != NULL && b->map != MAP_FAILED)
+         munmap(b->map, b->size);
+     if (b->fb_id != 0)
+         drmModeRmFB(fd, b->fb_id);
+     if (b->handle != 0)
+         drmModeDestroyDumbBuffer(fd, b->handle);
+     memset(b, 0, sizeof(*b));
+ }
+
+ static bool __drm_create_buffer(int fd, uint32_t width, uint32_t height, dazzle_drm_buffer_t *b)
+ {
+     uint64_t offset;
+
+     memset(b, 0, sizeof(*b));
+     if (drmModeCreateDumbBuffer(fd, width, height, 32, 0, &b->handle, &b->pitch, &b->size))
+         return false;
+     if (drmModeAddFB(fd, width, height, 24, 32, b->pitch, b->handle, &b->fb_id) ||
+         drmModeMapDumbBuffer(fd, b->handle, &offset))
+         goto fail;
+
+     b->map = mmap(0, b->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, offset);
+     if (b->map == MAP_FAILED)
+         goto fail;
+
+     memset(b->map, 0, b->size);
+     return true;
+
+ fail:
+     __drm_free_buffer(fd, b);
+     return false;
+ }
+
+ dazzle_context_t *dazzle_init_drm(dazzle_allocator_t alloc, int fd, uint32_t connector_id, uint32_t crtc_id, drmModeModeInfo *mode, uint32_t buffer_count)
+ {
+     if (mode == NULL || buffer_count < 2 || buffer_count > DAZZLE_DRM_MAX_BUFFERS)
+         return NULL;
+
+     dazzle_context_t *ctx = alloc.malloc(sizeof(dazzle_context_t));
+     if (ctx == NULL)
+         return NULL;
+
+     dazzle_drm_t *drm = alloc.malloc(sizeof(dazzle_drm_t));
+     if (drm == NULL)
+     {
+         alloc.free(ctx);
+         return NULL;
+     }
+     memset(drm, 0, sizeof(dazzle_drm_t));
+
+     drm->fd = fd;
+     drm->crtc_id = crtc_id;
+     drm->connector_id = connector_id;
+     drm->mode = *mode;
+     drm->buffer_count = buffer_count;
+
+     for (uint32_t i = 0; i < buffer_count; i++)
+     {
+         if (!__drm_create_buffer(fd, mode->hdisplay, mode->vdisplay, &drm->buffers[i]))
+         {
+             while (i-- > 0)
+                 __drm_free_buffer(fd, &drm->buffers[i]);
+             alloc.free(drm);
+             alloc.free(ctx);
+             return NULL;
+         }
+     }
+
+     // Dumb buffers are always XRGB8888
+     drm->fb.address = (uintptr_t)drm->buffers[0].map;
+     drm->fb.width = mode->hdisplay;
+     drm->fb.height = mode->vdisplay;
+     drm->fb.pitch = drm->buffers[0].pitch;
+     drm->fb.bpp = 32;
+     drm->fb.red_mask = 0xFF;
+     drm->fb.green_mask = 0xFF;
+     drm->fb.blue_mask = 0xFF;
+     drm->fb.alpha_mask = 0xFF;
+     drm->fb.red_shift = 16;
+     drm->fb.green_shift = 8;
+     drm->fb.blue_shift = 0;
+     drm->fb.alpha_shift = 24;
+
+     drm->saved_crtc = drmModeGetCrtc(fd, crtc_id);
+
+     __dazzle_context_init(ctx, alloc);
+     ctx->renderer_data = drm;
+
+     // Dumb buffers are usually write-combined, so no cheap readback
+     ctx->backend = __fb_backend(DAZZLE_CAP_FILL_SPAN | DAZZLE_CAP_FILL_RECT | DAZZLE_CAP_COPY_RECT | DAZZLE_CAP_BLIT | DAZZLE_CAP_BLEND | DAZZLE_CAP_READ_RECT | DAZZLE_CAP_DRAW_MONO | DAZZLE_CAP_DRAW_ALPHA);
+     ctx->backend.type = DAZZLE_RENDERER_TYPE_DRM;
+     ctx->backend.clear = dazzle_drm_clear;
+     ctx->backend.draw_element = dazzle_drm_draw_element;
+     ctx->backend.fill_span = dazzle_drm_fill_span;
+     ctx->backend.fill_rect = dazzle_drm_fill_rect;
+     ctx->backend.copy_rect = dazzle_drm_copy_rect;
+     ctx->backend.blit = dazzle_drm_blit;
+     ctx->backend.blend = dazzle_drm_blend;
+     ctx->backend.draw_mono = dazzle_drm_draw_mono;
+     ctx->backend.draw_alpha = dazzle_drm_draw_alpha;
+     ctx->backend.read_rect = dazzle_drm_read_rect;
+
+     return ctx;
+ }
+
+ void dazzle_drm_destroy(dazzle_context_t *ctx)
+ {
+     dazzle_drm_t *drm = (dazzle_drm_t *)ctx->renderer_data;
+     if (drm == NULL)
+         return;
+
+     __drm_wait_flip(drm);
+
+     if (drm->saved_crtc != NULL)
+     {
+         drmModeSetCrtc(drm->fd, drm->saved_crtc->crtc_id, drm->saved_crtc->buffer_id, drm->saved_crtc->x, drm->saved_crtc->y,
+                        &drm->connector_id, 1, &drm->saved_crtc->mode);
+         drmModeFreeCrtc(drm->saved_crtc);
+     }
+
+     for (uint32_t i = 0; i < drm->buffer_count; i++)
+         __drm_free_buffer(drm->fd, &drm->buffers[i]);
+
+     ctx->alloc.free(drm);
+     ctx->alloc.free(ctx);
+ }
+ #endif
+
+ #endif // __DRM_INC_C__
@@ -21,6 +21,23 @@
      uint8_t blue_shift;
      uint8_t alpha_shift;
  } dazzle_framebuffer_t;
+
+ typedef struct
+ {
+     // Placement, may hang off the screen//
+     int32_t x;
+     int32_t y;
+     uint32_t width;
+     uint32_t height;
+     bool visible;
+     bool on_screen;
+
+     // Device pixels, opacity mask and what was under the visible part//
+     uint8_t *pixels;
+     uint8_t *mask;
+     uint8_t *saved;
+     dazzle_rect_t saved_rect;
+ } dazzle_sprite_t;
  
  //======== Macro Definitions ========//
 
@@ -40,6 +57,45 @@
   * Initializes a new Dazzle framebuffer renderer using the framebuffer fb
   */
  dazzle_context_t *dazzle_init_fb(dazzle_allocator_t alloc, dazzle_framebuffer_t *fb);
+
+ /*
+  * __fb_backend(caps) -> dazzle_backend_t
+  * Returns the software framebuffer vtable advertising caps
+  */
+ dazzle_backend_t __fb_backend(uint32_t caps);
+
+ /*
+  * dazzle_fb_create_sprite(ctx,width,height,pixels) -> dazzle_sprite_t*
+  * Creates a save-under sprite from dazzle colors, pixels with zero alpha are
+  * see-through. Sprites live on top of single-buffered framebuffer and memory
+  * renderers; hide them before redrawing what is underneath, and hide
+  * overlapping sprites in the reverse order they were shown.
+  */
+ dazzle_sprite_t *dazzle_fb_create_sprite(dazzle_context_t *ctx, uint32_t width, uint32_t height, const uint32_t *pixels);
+
+ /*
+  * dazzle_fb_show_sprite(ctx,sprite,x,y) -> bool
+  * Saves the pixels under the sprite and draws it at (x,y)
+  */
+ bool dazzle_fb_show_sprite(dazzle_context_t *ctx, dazzle_sprite_t *sprite, int32_t x, int32_t y);
+
+ /*
+  * dazzle_fb_move_sprite(ctx,sprite,x,y) -> bool
+  * Moves a visible sprite, only the old and new sprite areas are touched
+  */
+ bool dazzle_fb_move_sprite(dazzle_context_t *ctx, dazzle_sprite_t *sprite, int32_t x, int32_t y);
+
+ /*
+  * dazzle_fb_hide_sprite(ctx,sprite) -> bool
+  * Puts the saved pixels back
+  */
+ bool dazzle_fb_hide_sprite(dazzle_context_t *ctx, dazzle_sprite_t *sprite);
+
+ /*
+  * dazzle_fb_destroy_sprite(ctx,sprite)
+  * Hides and frees a sprite
+  */
+ void dazzle_fb_destroy_sprite(dazzle_context_t *ctx, dazzle_sprite_t *sprite);
  
 
  //======== Function Implementations ========//
@@ -64,116 +120,729 @@
 
     uint32_t bypp = fb->bpp / 8;
 
+    if (width > fb->width - x) // clip instead of spilling into the next line
+        width = fb->width - x;
+
     memcpy((void *)fb->address + (y * fb->pitch) + (x * bypp), linebuf, width * bypp);
  }
  
+ uint64_t __unconvert_color(dazzle_framebuffer_t *fb, uint64_t px)
+ {
+     uint64_t color = 0;
+
+     color |= (px >> fb->red_shift) & fb->red_mask;
+     color |= ((px >> fb->green_shift) & fb->green_mask) << 8;
+     color |= ((px >> fb->blue_shift) & fb->blue_mask) << 16;
+     color |= ((px >> fb->alpha_shift) & fb->alpha_mask) << 24;
+
+     return color;
+ }
+
+ static inline void __fb_store_pixel(uint8_t *dst, uint32_t bypp, uint64_t px)
+ {
+     // Fixed sizes, so none of these become a call into memcpy
+     if (bypp == 4)
+         *(uint32_t *)dst = (uint32_t)px;
+     else if (bypp == 3)
+         memcpy(dst, &px, 3);
+     else if (bypp == 2)
+         memcpy(dst, &px, 2);
+     else
+         memcpy(dst, &px, bypp);
+ }
+
+ static inline void __fb_fill_row(uint8_t *dst, uint32_t bypp, uint32_t n, uint64_t px)
+ {
+     switch (bypp)
+     {
+     case 4:
+         for (uint32_t i = 0; i < n; i++)
+             ((uint32_t *)dst)[i] = (uint32_t)px;
+         break;
+     case 2:
+         for (uint32_t i = 0; i < n; i++)
+             ((uint16_t *)dst)[i] = (uint16_t)px;
+         break;
+     default:
+         for (uint32_t i = 0; i < n; i++)
+             memcpy(dst + i * bypp, &px, bypp);
+         break;
+     }
+ }
+
+ // Clipped span fill with an already converted pixel, shapes may hand in off-screen coordinates
+ static inline void __fb_fill_span(dazzle_context_t *ctx, dazzle_framebuffer_t *fb, int64_t x, int64_t y, int64_t width, uint64_t px)
+ {
+     if (y < 0 || y >= fb->height)
+         return;
+     if (x < 0)
+     {
+         width += x;
+         x = 0;
+     }
+     if (width > (int64_t)fb->width - x)
+         width = (int64_t)fb->width - x;
+     if (width <= 0)
+         return;
+
+     __DAZZLE_STAT(ctx, spans, 1);
+     __DAZZLE_STAT(ctx, pixels, width);
+
+     uint32_t bypp = fb->bpp / 8;
+     __fb_fill_row((uint8_t *)fb->address + (size_t)y * fb->pitch + (size_t)x * bypp, bypp, (uint32_t)width, px);
+ }
+
+ // Clips (x,y,width,height) to the framebuffer, false when nothing is left
+ static inline bool __fb_clip(dazzle_framebuffer_t *fb, uint32_t *x, uint32_t *y, uint32_t *width, uint32_t *height)
+ {
+     if (*x >= fb->width || *y >= fb->height)
+         return false;
+     if (*width > fb->width - *x)
+         *width = fb->width - *x;
+     if (*height > fb->height - *y)
+         *height = fb->height - *y;
+     return *width != 0 && *height != 0;
+ }
+
+ //======== 1bpp expansion ========//
+ // Bitmaps are rows of bits, most significant first, as in PSF fonts.
+ // Zero bits are left alone unless there is a background to paint.
+
+ typedef struct
+ {
+     uint32_t bypp;
+     uint64_t fg;
+     uint64_t bg;
+     bool opaque;
+     bool simd;
+ #ifdef DAZZLE_SIMD_SSE2
+     __m128i vfg;
+     __m128i vbg;
+ #endif
+     _Alignas(16) uint8_t lut[16][16]; // four opaque pixels per nibble, for formats without a SIMD kernel
+ } __fb_mono_t;
+
+ static void __fb_mono_init(__fb_mono_t *k, uint32_t bypp, uint64_t fg, uint64_t bg, bool opaque)
+ {
+     k->bypp = bypp;
+     k->fg = fg;
+     k->bg = bg;
+     k->opaque = opaque;
+     k->simd = false;
+ #ifdef DAZZLE_SIMD_SSE2
+     k->simd = bypp == 4 || bypp == 2;
+     k->vfg = bypp == 4 ? _mm_set1_epi32((int)fg) : _mm_set1_epi16((short)fg);
+     k->vbg = bypp == 4 ? _mm_set1_epi32((int)bg) : _mm_set1_epi16((short)bg);
+ #endif
+     if (opaque && !k->simd)
+         for (uint32_t n = 0; n < 16; n++)
+             for (uint32_t j = 0; j < 4; j++)
+                 __fb_store_pixel(k->lut[n] + j * bypp, bypp, n & (8 >> j) ? fg : bg);
+ }
+
+ // Eight pixels from one byte of the bitmap
+ static inline void __fb_mono8(uint8_t *dst, uint8_t byte, const __fb_mono_t *k)
+ {
+     if (byte == 0 && !k->opaque)
+         return;
+ #ifdef DAZZLE_SIMD_SSE2
+     if (k->bypp == 4)
+     {
+         const __m128i hi = _mm_set_epi32(0x10, 0x20, 0x40, 0x80), lo = _mm_set_epi32(0x01, 0x02, 0x04, 0x08);
+         __m128i v = _mm_set1_epi32(byte);
+         __m128i m0 = _mm_cmpeq_epi32(_mm_and_si128(v, hi), hi), m1 = _mm_cmpeq_epi32(_mm_and_si128(v, lo), lo);
+         __m128i u0 = k->opaque ? k->vbg : _mm_loadu_si128((__m128i *)dst);
+         __m128i u1 = k->opaque ? k->vbg : _mm_loadu_si128((__m128i *)(dst + 16));
+         _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_and_si128(m0, k->vfg), _mm_andnot_si128(m0, u0)));
+         _mm_storeu_si128((__m128i *)(dst + 16), _mm_or_si128(_mm_and_si128(m1, k->vfg), _mm_andnot_si128(m1, u1)));
+         return;
+     }
+     if (k->bypp == 2)
+     {
+         const __m128i bit = _mm_set_epi16(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+         __m128i m = _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16(byte), bit), bit);
+         __m128i u = k->opaque ? k->vbg : _mm_loadu_si128((__m128i *)dst);
+         _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_and_si128(m, k->vfg), _mm_andnot_si128(m, u)));
+         return;
+     }
+ #endif
+     if (k->opaque && k->bypp == 3)
+     {
+         memcpy(dst, k->lut[byte >> 4], 12);
+         memcpy(dst + 12, k->lut[byte & 0x0F], 12);
+         return;
+     }
+     if (k->opaque)
+     {
+         memcpy(dst, k->lut[byte >> 4], 4 * k->bypp);
+         memcpy(dst + 4 * k->bypp, k->lut[byte & 0x0F], 4 * k->bypp);
+         return;
+     }
+     // Visit only the set bits, the lowest one is the rightmost pixel
+     for (uint32_t b = byte; b != 0; b &= b - 1)
+         __fb_store_pixel(dst + (7 - __builtin_ctz(b)) * k->bypp, k->bypp, k->fg);
+ }
+
+ static void __fb_mono_row(uint8_t *dst, const uint8_t *bits, uint32_t width, const __fb_mono_t *k)
+ {
+     uint32_t step = 8 * k->bypp;
+     for (; width >= 8; width -= 8, bits++, dst += step)
+         __fb_mono8(dst, *bits, k);
+
+     // The last partial byte, pixel by pixel so nothing is written past the row
+     for (uint32_t j = 0; j < width; j++, dst += k->bypp)
+     {
+         if (*bits & (0x80 >> j))
+             __fb_store_pixel(dst, k->bypp, k->fg);
+         else if (k->opaque)
+             __fb_store_pixel(dst, k->bypp, k->bg);
+     }
+ }
+
+ //======== Coverage blending ========//
+
+ // s * a + d * (255 - a), rounded and divided by 255 on every byte at once.
+ // Two bytes share a 32-bit lane pair, none of the sums carry into the next.
+ static inline uint32_t __fb_mix32(uint32_t d, uint32_t s, uint32_t a)
+ {
+     uint32_t rb = (s & 0x00FF00FF) * a + (d & 0x00FF00FF) * (255 - a) + 0x00800080;
+     uint32_t ag = ((s >> 8) & 0x00FF00FF) * a + ((d >> 8) & 0x00FF00FF) * (255 - a) + 0x00800080;
+     rb = ((rb + ((rb >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+     ag = (ag + ((ag >> 8) & 0x00FF00FF)) & 0xFF00FF00;
+     return rb | ag;
+ }
+
+ // Device pixels whose channels are whole bytes can be mixed without converting back
+ static inline bool __fb_byte_channels(dazzle_framebuffer_t *fb)
+ {
+     return fb->bpp == 32 && fb->red_mask == 0xFF && fb->green_mask == 0xFF && fb->blue_mask == 0xFF &&
+            fb->red_shift % 8 == 0 && fb->green_shift % 8 == 0 && fb->blue_shift % 8 == 0 &&
+            fb->red_shift <= 24 && fb->green_shift <= 24 && fb->blue_shift <= 24;
+ }
+
+ //======== Backend hooks ========//
+
+ uint64_t dazzle_fb_map_color(dazzle_context_t *ctx, uint64_t color)
+ {
+     return __convert_color((dazzle_framebuffer_t *)ctx->renderer_data, color);
+ }
+
+ bool dazzle_fb_fill_span(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint64_t color)
+ {
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+     __fb_fill_span(ctx, fb, x, y, width, __convert_color(fb, color));
+     return true;
+ }
+
+ bool dazzle_fb_fill_rect(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint64_t color)
+ {
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+     if (!__fb_clip(fb, &x, &y, &width, &height))
+         return true;
+
+     __DAZZLE_STAT(ctx, spans, height);
+     __DAZZLE_STAT(ctx, pixels, (uint64_t)width * height);
+
+     uint64_t px = __convert_color(fb, color);
+     uint32_t bypp = fb->bpp / 8;
+     uint8_t *row = (uint8_t *)fb->address + (size_t)y * fb->pitch + (size_t)x * bypp;
+     for (uint32_t i = 0; i < height; i++, row += fb->pitch)
+         __fb_fill_row(row, bypp, width, px);
+     return true;
+ }
+
+ bool dazzle_fb_copy_rect(dazzle_context_t *ctx, uint32_t dst_x, uint32_t dst_y, uint32_t src_x, uint32_t src_y, uint32_t width, uint32_t height)
+ {
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+     if (!__fb_clip(fb, &src_x, &src_y, &width, &height) || !__fb_clip(fb, &dst_x, &dst_y, &width, &height))
+         return true;
+
+     uint32_t bypp = fb->bpp / 8;
+     size_t len = (size_t)width * bypp;
+     uint8_t *base = (uint8_t *)fb->address;
+     __DAZZLE_STAT(ctx, pixels, (uint64_t)width * height);
+     __DAZZLE_STAT(ctx, bytes_copied, (uint64_t)len * height);
+
+     // Walk rows against the direction of the move so overlapping copies work
+     if (dst_y > src_y)
+     {
+         for (uint32_t i = height; i-- > 0;)
+             memmove(base + (size_t)(dst_y + i) * fb->pitch + (size_t)dst_x * bypp, base + (size_t)(src_y + i) * fb->pitch + (size_t)src_x * bypp, len);
+     }
+     else
+     {
+         for (uint32_t i = 0; i < height; i++)
+             memmove(base + (size_t)(dst_y + i) * fb->pitch + (size_t)dst_x * bypp, base + (size_t)(src_y + i) * fb->pitch + (size_t)src_x * bypp, len);
+     }
+     return true;
+ }
+
+ bool dazzle_fb_blit(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void *pixels, uint32_t stride)
+ {
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+     if (pixels == NULL)
+         return false;
+     if (!__fb_clip(fb, &x, &y, &width, &height))
+         return true;
+
+     uint32_t bypp = fb->bpp / 8;
+     __DAZZLE_STAT(ctx, pixels, (uint64_t)width * height);
+     __DAZZLE_STAT(ctx, bytes_copied, (uint64_t)width * height * bypp);
+
+     const uint8_t *src = (const uint8_t *)pixels;
+     uint8_t *dst = (uint8_t *)fb->address + (size_t)y * fb->pitch + (size_t)x * bypp;
+     for (uint32_t i = 0; i < height; i++, src += stride, dst += fb->pitch)
+         memcpy(dst, src, (size_t)width * bypp);
+     return true;
+ }
+
+ bool dazzle_fb_blend(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint32_t *pixels, uint32_t stride)
+ {
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+     if (pixels == NULL)
+         return false;
+     if (!__fb_clip(fb, &x, &y, &width, &height))
+         return true;
+
+     uint32_t bypp = fb->bpp / 8;
+     __DAZZLE_STAT(ctx, pixels, (uint64_t)width * height);
+
+     const uint8_t *src = (const uint8_t *)pixels;
+     uint8_t *dst = (uint8_t *)fb->address + (size_t)y * fb->pitch + (size_t)x * bypp;
+     for (uint32_t i = 0; i < height; i++, src += stride, dst += fb->pitch)
+     {
+         const uint32_t *srow = (const uint32_t *)src;
+         for (uint32_t j = 0; j < width; j++)
+         {
+             uint32_t c = srow[j], a = c >> 24;
+             if (a == 0)
+                 continue;
+             if (a != 0xFF)
+             {
+                 uint64_t under = 0;
+                 memcpy(&under, dst + j * bypp, bypp);
+                 uint32_t d = (uint32_t)__unconvert_color(fb, under), mixed = 0xFF000000;
+                 for (uint32_t k = 0; k < 24; k += 8)
+                 {
+                     uint32_t sc = (c >> k) & 0xFF, dc = (d >> k) & 0xFF;
+                     mixed |= ((sc * a + dc * (255 - a) + 127) / 255) << k;
+                 }
+                 c = mixed;
+             }
+             __fb_store_pixel(dst + j * bypp, bypp, __convert_color(fb, c));
+         }
+     }
+     return true;
+ }
+
+ bool dazzle_fb_read_rect(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, void *pixels, uint32_t stride)
+ {
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+     if (pixels == NULL || !__fb_clip(fb, &x, &y, &width, &height))
+         return false;
+
+     uint32_t bypp = fb->bpp / 8;
+     __DAZZLE_STAT(ctx, bytes_copied, (uint64_t)width * height * bypp);
+
+     uint8_t *dst = (uint8_t *)pixels;
+     const uint8_t *src = (const uint8_t *)fb->address + (size_t)y * fb->pitch + (size_t)x * bypp;
+     for (uint32_t i = 0; i < height; i++, src += fb->pitch, dst += stride)
+         memcpy(dst, src, (size_t)width * bypp);
+     return true;
+ }
+
+ bool dazzle_fb_draw_mono(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t *bits, uint32_t stride, uint64_t fg, uint64_t bg)
+ {
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+     if (bits == NULL)
+         return false;
+     if (!__fb_clip(fb, &x, &y, &width, &height))
+         return true;
+
+     __DAZZLE_STAT(ctx, pixels, (uint64_t)width * height);
+
+     __fb_mono_t k;
+     uint32_t bypp = fb->bpp / 8;
+     __fb_mono_init(&k, bypp, __convert_color(fb, fg), __convert_color(fb, bg), (bg >> 24) != 0);
+
+     uint8_t *dst = (uint8_t *)fb->address + (size_t)y * fb->pitch + (size_t)x * bypp;
+     for (uint32_t i = 0; i < height; i++, bits += stride, dst += fb->pitch)
+         __fb_mono_row(dst, bits, width, &k);
+     return true;
+ }
+
+ bool dazzle_fb_draw_alpha(dazzle_context_t *ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t *alpha, uint32_t stride, uint64_t color)
+ {
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+     if (alpha == NULL)
+         return false;
+     if (!__fb_clip(fb, &x, &y, &width, &height))
+         return true;
+
+     __DAZZLE_STAT(ctx, pixels, (uint64_t)width * height);
+
+     uint32_t bypp = fb->bpp / 8, ca = (uint32_t)(color >> 24) & 0xFF;
+     uint64_t px = __convert_color(fb, color | 0xFF000000);
+     bool bytes = __fb_byte_channels(fb);
+     // Bytes outside the color channels are written as converted, never mixed
+     uint32_t channels = 0xFFu << fb->red_shift | 0xFFu << fb->green_shift | 0xFFu << fb->blue_shift;
+     uint8_t *dst = (uint8_t *)fb->address + (size_t)y * fb->pitch + (size_t)x * bypp;
+     for (uint32_t i = 0; i < height; i++, alpha += stride, dst += fb->pitch)
+     {
+         for (uint32_t j = 0; j < width; j++)
+         {
+             uint32_t a = alpha[j];
+             if (ca != 0xFF)
+                 a = (a * ca + 127) / 255;
+             // Most of a glyph is either empty or fully covered
+             if (a == 0)
+                 continue;
+             if (a == 0xFF)
+             {
+                 __fb_store_pixel(dst + j * bypp, bypp, px);
+                 continue;
+             }
+             if (bytes)
+             {
+                 uint32_t under;
+                 memcpy(&under, dst + j * 4, 4);
+                 under = (__fb_mix32(under, (uint32_t)px, a) & channels) | ((uint32_t)px & ~channels);
+                 memcpy(dst + j * 4, &under, 4);
+                 continue;
+             }
+             uint64_t under = 0;
+             memcpy(&under, dst + j * bypp, bypp);
+             uint32_t d = (uint32_t)__unconvert_color(fb, under);
+             __fb_store_pixel(dst + j * bypp, bypp, __convert_color(fb, 0xFF000000 | __fb_mix32(d, (uint32_t)color, a)));
+         }
+     }
+     return true;
+ }
+
  bool dazzle_fb_clear(dazzle_context_t *ctx, uint64_t color)
  {
     if (ctx->renderer_data == NULL)
         return false;
     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
 
-    uint64_t converted = __convert_color(fb, color);
+    return dazzle_fb_fill_rect(ctx, 0, 0, fb->width, fb->height, color);
+ }
 
-    uint32_t bypp = fb->bpp / 8;
+ //======== Scaled blits ========//
+ // Source coordinates are stepped in 16.16 fixed point. Only the destination
+ // pixels that survive clipping are ever sampled.
 
-    void *linebuf = ctx->alloc.malloc(fb->pitch * 2);
-    for (int j = 0; j < fb->width * 2; j++)
-    {
-        memcpy(linebuf + (j * bypp), &converted, bypp);
-    }
+ static bool __fb_draw_scaled_nearest(dazzle_context_t *ctx, dazzle_framebuffer_t *fb, dazzle_retained_element_t *e, uint8_t *linebuf)
+ {
+     uint32_t bypp = fb->bpp / 8;
+     uint32_t x = e->type_data.scaled_blit.x, y = e->type_data.scaled_blit.y;
+     uint32_t sw = e->type_data.scaled_blit.src_width, sh = e->type_data.scaled_blit.src_height;
+     uint32_t dw = e->type_data.scaled_blit.width, dh = e->type_data.scaled_blit.height;
+     // Translated to device format already, bypp bytes per pixel
+     const uint8_t *src = (const uint8_t *)e->type_data.scaled_blit.buffer;
+
+     if (x >= fb->width || y >= fb->height || dw == 0 || dh == 0)
+         return true;
 
-    for(int i = 0; i < fb->height / 2; i++){
-        draw_span(fb, 0, i * 2, fb->width * 2, linebuf);
-    }
-    ctx->alloc.free(linebuf);
-    return true;
+     uint32_t vis_w = (fb->width - x) < dw ? (fb->width - x) : dw;
+     uint32_t vis_h = (fb->height - y) < dh ? (fb->height - y) : dh;
+     uint32_t step_x = (uint32_t)(((uint64_t)sw << 16) / dw);
+     uint32_t step_y = (uint32_t)(((uint64_t)sh << 16) / dh);
+
+     uint32_t *xidx = __dazzle_malloc(ctx, vis_w * sizeof(uint32_t));
+     if (xidx == NULL)
+         return false;
+
+     uint64_t sx = step_x / 2;
+     for (uint32_t i = 0; i < vis_w; i++, sx += step_x)
+     {
+         uint32_t v = (uint32_t)(sx >> 16);
+         xidx[i] = v < sw ? v : sw - 1;
+     }
+
+     uint32_t last_row = UINT32_MAX;
+     uint64_t sy = step_y / 2;
+     for (uint32_t j = 0; j < vis_h; j++, sy += step_y)
+     {
+         uint32_t row = (uint32_t)(sy >> 16);
+         if (row >= sh)
+             row = sh - 1;
+
+         // Upscaling repeats source rows, the line is already built
+         if (row != last_row)
+         {
+             const uint8_t *srow = src + (size_t)row * sw * bypp;
+             if (bypp == 4)
+             {
+                 for (uint32_t i = 0; i < vis_w; i++)
+                     ((uint32_t *)linebuf)[i] = ((const uint32_t *)srow)[xidx[i]];
+             }
+             else
+             {
+                 for (uint32_t i = 0; i < vis_w; i++)
+                     memcpy(linebuf + i * bypp, srow + (size_t)xidx[i] * bypp, bypp);
+             }
+             last_row = row;
+         }
+         draw_span(fb, x, y + j, vis_w, linebuf);
+         __DAZZLE_STAT(ctx, spans, 1);
+         __DAZZLE_STAT(ctx, pixels, vis_w);
+     }
+
+     __dazzle_free(ctx, xidx);
+     return true;
  }
- 
- bool dazzle_fb_draw_element(dazzle_context_t *ctx, dazzle_retained_element_t *e)
+
+ // Horizontal pass: lerp two taps per destination pixel, weights are 0..255
+ static void __fb_scale_row_h(const uint32_t *row, const uint32_t *x0, const uint32_t *x1, const uint16_t *fx, uint32_t n, uint32_t *out)
+ {
+     uint32_t i = 0;
+ #ifdef DAZZLE_SIMD_SSE2
+     const __m128i zero = _mm_setzero_si128();
+     const __m128i full = _mm_set1_epi16(256);
+     for (; i + 4 <= n; i += 4)
+     {
+         __m128i a = _mm_set_epi32(row[x0[i + 3]], row[x0[i + 2]], row[x0[i + 1]], row[x0[i]]);
+         __m128i b = _mm_set_epi32(row[x1[i + 3]], row[x1[i + 2]], row[x1[i + 1]], row[x1[i]]);
+         __m128i wlo = _mm_set_epi16(fx[i + 1], fx[i + 1], fx[i + 1], fx[i + 1], fx[i], fx[i], fx[i], fx[i]);
+         __m128i whi = _mm_set_epi16(fx[i + 3], fx[i + 3], fx[i + 3], fx[i + 3], fx[i + 2], fx[i + 2], fx[i + 2], fx[i + 2]);
+
+         __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), _mm_sub_epi16(full, wlo)),
+                                    _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), wlo));
+         __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), _mm_sub_epi16(full, whi)),
+                                    _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), whi));
+
+         _mm_storeu_si128((__m128i *)(out + i), _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)));
+     }
+ #endif
+     for (; i < n; i++)
+     {
+         uint32_t a = row[x0[i]], b = row[x1[i]], w = fx[i], res = 0;
+         for (uint32_t c = 0; c < 32; c += 8)
+         {
+             uint32_t ca = (a >> c) & 0xFF, cb = (b >> c) & 0xFF;
+             res |= (((ca * (256 - w) + cb * w) >> 8) & 0xFF) << c;
+         }
+         out[i] = res;
+     }
+ }
+
+ // Vertical pass: one weight for the whole row
+ static void __fb_scale_row_v(const uint32_t *top, const uint32_t *bottom, uint32_t w, uint32_t n, uint32_t *out)
+ {
+     uint32_t i = 0;
+ #ifdef DAZZLE_SIMD_SSE2
+     const __m128i zero = _mm_setzero_si128();
+     const __m128i wb = _mm_set1_epi16((int16_t)w);
+     const __m128i wt = _mm_set1_epi16((int16_t)(256 - w));
+     for (; i + 4 <= n; i += 4)
+     {
+         __m128i a = _mm_loadu_si128((const __m128i *)(top + i));
+         __m128i b = _mm_loadu_si128((const __m128i *)(bottom + i));
+
+         __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), wt), _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), wb));
+         __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), wt), _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), wb));
+
+         _mm_storeu_si128((__m128i *)(out + i), _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)));
+     }
+ #endif
+     for (; i < n; i++)
+     {
+         uint32_t a = top[i], b = bottom[i], res = 0;
+         for (uint32_t c = 0; c < 32; c += 8)
+         {
+             uint32_t ca = (a >> c) & 0xFF, cb = (b >> c) & 0xFF;
+             res |= (((ca * (256 - w) + cb * w) >> 8) & 0xFF) << c;
+         }
+         out[i] = res;
+     }
+ }
+
+ // Maps destination index i to a pixel-centre aligned 16.16 source coordinate
+ static inline void __fb_bilinear_tap(uint32_t i, uint32_t step, uint32_t limit, uint32_t *p0, uint32_t *p1, uint16_t *frac)
+ {
+     int64_t s = (int64_t)i * step + (step >> 1) - 0x8000;
+     if (s < 0)
+         s = 0;
+     uint32_t v = (uint32_t)(s >> 16);
+     if (v >= limit - 1)
+     {
+         *p0 = *p1 = limit - 1;
+         *frac = 0;
+         return;
+     }
+     *p0 = v;
+     *p1 = v + 1;
+     *frac = (uint16_t)((s >> 8) & 0xFF);
+ }
+
+ static bool __fb_draw_scaled_bilinear(dazzle_context_t *ctx, dazzle_framebuffer_t *fb, dazzle_retained_element_t *e, uint8_t *linebuf)
  {
-     if (ctx->renderer_data == NULL)
-         return false;
-     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
-     uint64_t color = 0;
      uint32_t bypp = fb->bpp / 8;
-     void* linebuf = NULL;
- 
-     switch (e->type)
+     uint32_t x = e->type_data.scaled_blit.x, y = e->type_data.scaled_blit.y;
+     uint32_t sw = e->type_data.scaled_blit.src_width, sh = e->type_data.scaled_blit.src_height;
+     uint32_t dw = e->type_data.scaled_blit.width, dh = e->type_data.scaled_blit.height;
+     uint32_t *src = (uint32_t *)e->type_data.scaled_blit.buffer;
+
+     if (x >= fb->width || y >= fb->height || dw == 0 || dh == 0)
+         return true;
+
+     uint32_t vis_w = (fb->width - x) < dw ? (fb->width - x) : dw;
+     uint32_t vis_h = (fb->height - y) < dh ? (fb->height - y) : dh;
+     uint32_t step_x = (uint32_t)(((uint64_t)sw << 16) / dw);
+     uint32_t step_y = (uint32_t)(((uint64_t)sh << 16) / dh);
+
+     // x0 | x1 | h0 | h1 | out as uint32_t, then fx as uint16_t
+     uint32_t *scratch = __dazzle_malloc(ctx, vis_w * (5 * sizeof(uint32_t) + sizeof(uint16_t)));
+     if (scratch == NULL)
+         return false;
+     uint32_t *x0 = scratch;
+     uint32_t *x1 = x0 + vis_w;
+     uint32_t *rows[2] = {x1 + vis_w, x1 + 2 * vis_w};
+     uint32_t *out = x1 + 3 * vis_w;
+     uint16_t *fx = (uint16_t *)(out + vis_w);
+
+     for (uint32_t i = 0; i < vis_w; i++)
+         __fb_bilinear_tap(i, step_x, sw, &x0[i], &x1[i], &fx[i]);
+
+     // Horizontally filtered source rows are cached and reused between destination rows
+     uint32_t cached[2] = {UINT32_MAX, UINT32_MAX};
+
+     for (uint32_t j = 0; j < vis_h; j++)
      {
-     case DAZZLE_RETAINED_TRIANGLE:
-         color = __convert_color(fb, e->type_data.triangle.color);
-         break;
-     case DAZZLE_RETAINED_RECTANGLE:
-         color = __convert_color(fb, e->type_data.rect.color);
-         break;
-     case DAZZLE_RETAINED_CIRCLE:
-         color = __convert_color(fb, e->type_data.circle.color);
-         break;
-     case DAZZLE_RETAINED_BLITABLE:
-        if(!e->type_data.blit.translated){
-           uint32_t* newbuf = ctx->alloc.malloc(e->type_data.blit.width * e->type_data.blit.height * bypp);
-           uint32_t size = e->type_data.blit.width * e->type_data.blit.height;
-           for(uint32_t i = 0; i < size; i++){
-                uint32_t col = ((uint32_t*)e->type_data.blit.buffer)[i];
-                newbuf[i] = (uint32_t)__convert_color(fb, col);
-           }
-           e->type_data.blit.buffer = newbuf;
-           e->type_data.blit.translated = true;
-        }
+         uint32_t r0, r1;
+         uint16_t fy;
+         __fb_bilinear_tap(j, step_y, sh, &r0, &r1, &fy);
+
+         if (cached[0] != r0)
+         {
+             if (cached[1] == r0)
+             {
+                 SWAP(rows[0], rows[1]);
+                 SWAP(cached[0], cached[1]);
+             }
+             else
+             {
+                 __fb_scale_row_h(src + (size_t)r0 * sw, x0, x1, fx, vis_w, rows[0]);
+                 cached[0] = r0;
+             }
+         }
+         if (fy != 0 && cached[1] != r1)
+         {
+             __fb_scale_row_h(src + (size_t)r1 * sw, x0, x1, fx, vis_w, rows[1]);
+             cached[1] = r1;
+         }
+
+         const uint32_t *blended = rows[0];
+         if (fy != 0)
+         {
+             __fb_scale_row_v(rows[0], rows[1], fy, vis_w, out);
+             blended = out;
+         }
+
+         for (uint32_t i = 0; i < vis_w; i++)
+             __fb_store_pixel(linebuf + i * bypp, bypp, __convert_color(fb, blended[i]));
+
+         draw_span(fb, x, y + j, vis_w, linebuf);
+         __DAZZLE_STAT(ctx, spans, 1);
+         __DAZZLE_STAT(ctx, pixels, vis_w);
      }
 
-    linebuf = ctx->alloc.malloc(fb->pitch);
-    if(linebuf == NULL)
-        return false;
+     __dazzle_free(ctx, scratch);
+     return true;
+ }
 
-    for (int j = 0; j < fb->width; j++)
-    {
-        memcpy(linebuf + (j * bypp), &color, bypp);
-    }
- 
+ // Converts a blitable's source colors to packed device pixels once
+ static bool __fb_translate(dazzle_context_t *ctx, dazzle_framebuffer_t *fb, void **buffer, uint32_t count)
+ {
+     DAZZLE_TRACE_SCOPE("blit_translate");
+     uint32_t bypp = fb->bpp / 8;
+     uint8_t *newbuf = __dazzle_malloc(ctx, (size_t)count * bypp);
+     if (newbuf == NULL)
+         return false;
+     __DAZZLE_STAT(ctx, blit_translations, 1);
+
+     for (uint32_t i = 0; i < count; i++)
+         __fb_store_pixel(newbuf + (size_t)i * bypp, bypp, __convert_color(fb, ((uint32_t *)*buffer)[i]));
+
+     *buffer = newbuf;
+     return true;
+ }
+
+ bool dazzle_fb_draw_element(dazzle_context_t *ctx, dazzle_retained_element_t *e)
+ {
      if (ctx->renderer_data == NULL)
          return false;
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+     uint32_t bypp = fb->bpp / 8;
+     uint64_t color = 0;
+
      switch (e->type)
      {
         case DAZZLE_RETAINED_RECTANGLE:
+        {
             uint32_t top = e->type_data.rect.y;
             uint32_t bottom = e->type_data.rect.y + e->type_data.rect.height - 1;
             uint32_t left = e->type_data.rect.x;
             uint32_t right = e->type_data.rect.x + e->type_data.rect.width - 1;
+
+            if (e->type_data.rect.width == 0 || e->type_data.rect.height == 0)
+                return true;
             if (e->type_data.rect.filled)
-            {
-                for (int i = top; i < bottom; i++)
-                {
-                    draw_span(fb, left, i, e->type_data.rect.width, linebuf);
-                }
-            }
-            else
-            {
-                //Top and bottom
-                draw_span(fb, left, top,    e->type_data.rect.width, linebuf);
-                draw_span(fb, left, bottom, e->type_data.rect.width, linebuf);
+                return dazzle_fb_fill_rect(ctx, left, top, e->type_data.rect.width, e->type_data.rect.height, e->type_data.rect.color);
 
-                //Left and right
-                for (int i = top + 1; i < bottom; i++)
-                {
-                    draw_span(fb, left,  i, 1, linebuf);
-                    draw_span(fb, right, i, 1, linebuf);
-                }
+            color = __convert_color(fb, e->type_data.rect.color);
+
+            //Top and bottom
+            __fb_fill_span(ctx, fb, left, top,    e->type_data.rect.width, color);
+            __fb_fill_span(ctx, fb, left, bottom, e->type_data.rect.width, color);
+
+            //Left and right
+            for (uint32_t i = top + 1; i < bottom; i++)
+            {
+                __fb_fill_span(ctx, fb, left,  i, 1, color);
+                __fb_fill_span(ctx, fb, right, i, 1, color);
             }
             break;
+        }
         case DAZZLE_RETAINED_BLITABLE:
-            for (int i = 0; i < e->type_data.blit.height; i++)
+            if (!e->type_data.blit.translated)
             {
-                memcpy((uint8_t *)fb->address + ((e->type_data.blit.y + i) * fb->pitch) + (e->type_data.blit.x * bypp), e->type_data.blit.buffer + (i * e->type_data.blit.width * bypp), e->type_data.blit.width * bypp);
+                if (!__fb_translate(ctx, fb, &e->type_data.blit.buffer, e->type_data.blit.width * e->type_data.blit.height))
+                    return false;
+                e->type_data.blit.stride = e->type_data.blit.width * bypp;
+                e->type_data.blit.translated = true;
             }
-            break;
+            return dazzle_fb_blit(ctx, e->type_data.blit.x, e->type_data.blit.y, e->type_data.blit.width, e->type_data.blit.height,
+                                  e->type_data.blit.buffer, e->type_data.blit.stride);
+        case DAZZLE_RETAINED_SCALED_BLITABLE:
+        {
+            // Nearest only picks pixels, so it can work in device format.
+            // Bilinear has to interpolate in the source format.
+            if (e->type_data.scaled_blit.filter == DAZZLE_FILTER_NEAREST && !e->type_data.scaled_blit.translated)
+            {
+                if (!__fb_translate(ctx, fb, &e->type_data.scaled_blit.buffer, e->type_data.scaled_blit.src_width * e->type_data.scaled_blit.src_height))
+                    return false;
+                e->type_data.scaled_blit.translated = true;
+            }
+
+            DAZZLE_TRACE_SCOPE("scaled_blit");
+            uint8_t *linebuf = __dazzle_malloc(ctx, fb->pitch);
+            if (linebuf == NULL)
+                return false;
+            bool ok = e->type_data.scaled_blit.filter == DAZZLE_FILTER_BILINEAR
+                          ? __fb_draw_scaled_bilinear(ctx, fb, e, linebuf)
+                          : __fb_draw_scaled_nearest(ctx, fb, e, linebuf);
+            __dazzle_free(ctx, linebuf);
+            return ok;
+        }
         case DAZZLE_RETAINED_TRIANGLE:
-            uint32_t x1 = e->type_data.triangle.x1, y1 = e->type_data.triangle.y1;
-            uint32_t x2 = e->type_data.triangle.x2, y2 = e->type_data.triangle.y2;
-            uint32_t x3 = e->type_data.triangle.x3, y3 = e->type_data.triangle.y3;
+        {
+            int32_t x1 = e->type_data.triangle.x1, y1 = e->type_data.triangle.y1;
+            int32_t x2 = e->type_data.triangle.x2, y2 = e->type_data.triangle.y2;
+            int32_t x3 = e->type_data.triangle.x3, y3 = e->type_data.triangle.y3;
 
-            if (y1 == y3) return false;
+            color = __convert_color(fb, e->type_data.triangle.color);
 
             // Sort vertices by Y coordinate
             if (y1 > y2)
@@ -192,73 +861,71 @@
                 SWAP(y2, y3);
             }
 
+            if (y1 == y3) return false;
+
             // Compute slopes (fixed-point math)
-            int dx1 = (y2 != y1) ? ((x2 - x1) * 0xffff) / (y2 - y1) : 0;
-            int dx2 = (y3 != y1) ? ((x3 - x1) * 0xffff) / (y3 - y1) : 0;
-            int dx3 = (y3 != y2) ? ((x3 - x2) * 0xffff) / (y3 - y2) : 0;
+            int64_t dx1 = (y2 != y1) ? ((int64_t)(x2 - x1) * 0xffff) / (y2 - y1) : 0;
+            int64_t dx2 = (y3 != y1) ? ((int64_t)(x3 - x1) * 0xffff) / (y3 - y1) : 0;
+            int64_t dx3 = (y3 != y2) ? ((int64_t)(x3 - x2) * 0xffff) / (y3 - y2) : 0;
 
-            int xL = x1 * 0xffff, xR = (x1 + 1) * 0xffff;
+            int64_t xL = (int64_t)x1 * 0xffff, xR = (int64_t)(x1 + 1) * 0xffff;
 
             // Draw upper part of the triangle
-            for (uint32_t i = y1; i < y2; i++)
+            for (int32_t i = y1; i < y2; i++)
             {
-                int x_start = xL / 0xffff;
-                int x_end = xR / 0xffff;
+                int64_t x_start = xL / 0xffff;
+                int64_t x_end = xR / 0xffff;
 
                 if (x_start > x_end)
                     SWAP(x_start, x_end);
-                if (x_start < 0)
-                    x_start = 0;
-                if (x_end >= fb->width)
-                    x_end = fb->width - 1;
 
-                draw_span(fb, x_start, i, x_end - x_start, linebuf);
+                __fb_fill_span(ctx, fb, x_start, i, x_end - x_start, color);
                 xL += dx1;
                 xR += dx2;
             }
 
             // Draw lower part of the triangle
-            xL = x2 * 0xffff;
-            for (uint32_t i = y2; i < y3; i++)
+            xL = (int64_t)x2 * 0xffff;
+            for (int32_t i = y2; i < y3; i++)
             {
-                int x_start = xL / 0xffff;
-                int x_end = xR / 0xffff;
+                int64_t x_start = xL / 0xffff;
+                int64_t x_end = xR / 0xffff;
 
                 if (x_start > x_end)
                     SWAP(x_start, x_end);
-                if (x_start < 0)
-                    x_start = 0;
-                if (x_end >= fb->width)
-                    x_end = fb->width - 1;
 
-                draw_span(fb, x_start, i, x_end - x_start, linebuf);
+                __fb_fill_span(ctx, fb, x_start, i, x_end - x_start, color);
                 xL += dx3;
                 xR += dx2;
             }
             break;
+        }
         case DAZZLE_RETAINED_CIRCLE:
-            int cx = e->type_data.circle.x, cy = e->type_data.circle.y, r = e->type_data.circle.radius;
-            int x = r, y = 0;
-            int p = 1 - r; // Initial decision parameter
+        {
+            int64_t cx = e->type_data.circle.x, cy = e->type_data.circle.y, r = e->type_data.circle.radius;
+            int64_t x = r, y = 0;
+            int64_t p = 1 - r; // Initial decision parameter
+
+            color = __convert_color(fb, e->type_data.circle.color);
             while (x >= y)
             {
                 // Draw symmetrical points
                 if (e->type_data.circle.filled)
                 {
-                    draw_span(fb, cx - x, cy + y, 2 * x + 1, linebuf);
-                    draw_span(fb, cx - x, cy - y, 2 * x + 1, linebuf);
-                    draw_span(fb, cx - y, cy + x, 2 * y + 1, linebuf);
-                    draw_span(fb, cx - y, cy - x, 2 * y + 1, linebuf);
+                    __fb_fill_span(ctx, fb, cx - x, cy + y, 2 * x + 1, color);
+                    __fb_fill_span(ctx, fb, cx - x, cy - y, 2 * x + 1, color);
+                    __fb_fill_span(ctx, fb, cx - y, cy + x, 2 * y + 1, color);
+                    __fb_fill_span(ctx, fb, cx - y, cy - x, 2 * y + 1, color);
                 }
                 else {
-                    draw_span(fb, cx + x, cy + y, 1, linebuf);
-                    draw_span(fb, cx - x, cy + y, 1, linebuf);
-                    draw_span(fb, cx + x, cy - y, 1, linebuf);
-                    draw_span(fb, cx - x, cy - y, 1, linebuf);
-                    draw_span(fb, cx + y, cy + x, 1, linebuf);
-                    draw_span(fb, cx - y, cy + x, 1, linebuf);
-                    draw_span(fb, cx + y, cy - x, 1, linebuf);
-                    draw_span(fb, cx - y, cy - x, 1, linebuf);
+                    __fb_fill_span(ctx, fb, cx + x, cy + y, 1, color);
+                    __fb_fill_span(ctx, fb, cx - x, cy + y, 1, color);
+                    __fb_fill_span(ctx, fb, cx + x, cy - y, 1, color);
+                    __fb_fill_span(ctx, fb, cx - x, cy - y, 1, color);
+                    __fb_fill_span(ctx, fb, cx + y, cy + x, 1, color);
+                    __fb_fill_span(ctx, fb, cx - y, cy + x, 1, color);
+                    __fb_fill_span(ctx, fb, cx + y, cy - x, 1, color);
+                    __fb_fill_span(ctx, fb, cx - y, cy - x, 1, color);
                 }
 
                 y++; // Move to next scanline
@@ -273,12 +940,36 @@
                 }
             }
             break;
+        }
+        default:
+            return false;
      }
-     if (linebuf != NULL)
-         ctx->alloc.free(linebuf);
      return true;
  }
- 
+
+ // Shared by every backend that renders into a dazzle_framebuffer_t,
+ // which has to be the first member of their renderer_data
+ dazzle_backend_t __fb_backend(uint32_t caps)
+ {
+     dazzle_backend_t backend = {0};
+
+     backend.type = DAZZLE_RENDERER_TYPE_FRAMEBUFFER;
+     backend.caps = caps;
+     backend.draw_element = dazzle_fb_draw_element;
+     backend.clear = dazzle_fb_clear;
+     backend.map_color = dazzle_fb_map_color;
+     backend.fill_span = dazzle_fb_fill_span;
+     backend.fill_rect = dazzle_fb_fill_rect;
+     backend.copy_rect = dazzle_fb_copy_rect;
+     backend.blit = dazzle_fb_blit;
+     backend.blend = dazzle_fb_blend;
+     backend.read_rect = dazzle_fb_read_rect;
+     backend.draw_mono = dazzle_fb_draw_mono;
+     backend.draw_alpha = dazzle_fb_draw_alpha;
+
+     return backend;
+ }
+
  dazzle_context_t *dazzle_init_fb(dazzle_allocator_t alloc, dazzle_framebuffer_t *fb)
  {
      dazzle_context_t *ctx = alloc.malloc(sizeof(dazzle_context_t));
@@ -286,10 +977,7 @@
      if (ctx == NULL)
          return NULL;
  
-     ctx->alloc = alloc;
-     ctx->retained_count = 0;
-     ctx->retained = NULL;
-     ctx->last = NULL;
+     __dazzle_context_init(ctx, alloc);
      ctx->renderer_data = alloc.malloc(sizeof(dazzle_framebuffer_t));
  
      if (ctx->renderer_data == NULL)
@@ -300,11 +988,188 @@
  
      memcpy(ctx->renderer_data, fb, sizeof(dazzle_framebuffer_t));
  
-     ctx->clear = dazzle_fb_clear;
-     ctx->draw_element = dazzle_fb_draw_element;
+     // Writes go straight to device memory, reading it back may be slow
+     ctx->backend = __fb_backend(DAZZLE_CAP_FILL_SPAN | DAZZLE_CAP_FILL_RECT | DAZZLE_CAP_COPY_RECT | DAZZLE_CAP_BLIT | DAZZLE_CAP_BLEND | DAZZLE_CAP_READ_RECT | DAZZLE_CAP_DRAW_MONO | DAZZLE_CAP_DRAW_ALPHA);
  
      return ctx;
  }
+
+ //======== Sprites ========//
+
+ // Clips a sprite placed at (x,y) to the screen, false when fully off-screen
+ static bool __fb_sprite_clip(dazzle_framebuffer_t *fb, int32_t x, int32_t y, uint32_t width, uint32_t height, dazzle_rect_t *out)
+ {
+     int64_t x0 = x < 0 ? 0 : x, y0 = y < 0 ? 0 : y;
+     int64_t x1 = (int64_t)x + width, y1 = (int64_t)y + height;
+     if (x1 > fb->width)
+         x1 = fb->width;
+     if (y1 > fb->height)
+         y1 = fb->height;
+     if (x1 <= x0 || y1 <= y0)
+         return false;
+
+     out->x = (uint32_t)x0;
+     out->y = (uint32_t)y0;
+     out->width = (uint32_t)(x1 - x0);
+     out->height = (uint32_t)(y1 - y0);
+     return true;
+ }
+
+ // Copies rect r between the screen and a buffer holding exactly r
+ static void __fb_rect_io(dazzle_context_t *ctx, dazzle_framebuffer_t *fb, const dazzle_rect_t *r, uint8_t *buf, bool to_screen)
+ {
+     uint32_t bypp = fb->bpp / 8;
+     size_t len = (size_t)r->width * bypp;
+     __DAZZLE_STAT(ctx, bytes_copied, (uint64_t)len * r->height);
+     uint8_t *row = (uint8_t *)fb->address + (size_t)r->y * fb->pitch + (size_t)r->x * bypp;
+     for (uint32_t i = 0; i < r->height; i++, row += fb->pitch, buf += len)
+     {
+         if (to_screen)
+             memcpy(row, buf, len);
+         else
+             memcpy(buf, row, len);
+     }
+ }
+
+ // Paints the opaque sprite pixels inside clip into dst, a buffer covering area
+ static void __fb_sprite_paint(dazzle_framebuffer_t *fb, dazzle_sprite_t *s, const dazzle_rect_t *clip, uint8_t *dst, const dazzle_rect_t *area, uint32_t dst_stride)
+ {
+     uint32_t bypp = fb->bpp / 8;
+     for (uint32_t j = 0; j < clip->height; j++)
+     {
+         uint32_t sy = clip->y + j - s->y;
+         uint32_t sx = clip->x - s->x;
+         const uint8_t *mask = s->mask + (size_t)sy * s->width + sx;
+         const uint8_t *src = s->pixels + ((size_t)sy * s->width + sx) * bypp;
+         uint8_t *out = dst + (size_t)(clip->y + j - area->y) * dst_stride + (size_t)(clip->x - area->x) * bypp;
+         for (uint32_t i = 0; i < clip->width; i++)
+         {
+             if (mask[i])
+                 memcpy(out + i * bypp, src + i * bypp, bypp);
+         }
+     }
+ }
+
+ dazzle_sprite_t *dazzle_fb_create_sprite(dazzle_context_t *ctx, uint32_t width, uint32_t height, const uint32_t *pixels)
+ {
+     if (ctx->renderer_data == NULL || ctx->backend.type == DAZZLE_RENDERER_TYPE_DRM || width == 0 || height == 0 || pixels == NULL)
+         return NULL;
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+     uint32_t bypp = fb->bpp / 8;
+     size_t count = (size_t)width * height;
+
+     // One block: header | device pixels | saved pixels | mask
+     dazzle_sprite_t *s = __dazzle_malloc(ctx, sizeof(dazzle_sprite_t) + count * (2 * bypp + 1));
+     if (s == NULL)
+         return NULL;
+
+     memset(s, 0, sizeof(dazzle_sprite_t));
+     s->width = width;
+     s->height = height;
+     s->pixels = (uint8_t *)(s + 1);
+     s->saved = s->pixels + count * bypp;
+     s->mask = s->saved + count * bypp;
+
+     for (size_t i = 0; i < count; i++)
+     {
+         __fb_store_pixel(s->pixels + i * bypp, bypp, __convert_color(fb, pixels[i]));
+         s->mask[i] = (pixels[i] >> 24) != 0;
+     }
+     return s;
+ }
+
+ bool dazzle_fb_show_sprite(dazzle_context_t *ctx, dazzle_sprite_t *s, int32_t x, int32_t y)
+ {
+     if (s->visible)
+         return dazzle_fb_move_sprite(ctx, s, x, y);
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+
+     s->x = x;
+     s->y = y;
+     s->visible = true;
+     s->on_screen = __fb_sprite_clip(fb, x, y, s->width, s->height, &s->saved_rect);
+     if (!s->on_screen)
+         return true;
+
+     dazzle_add_damage(ctx, s->saved_rect.x, s->saved_rect.y, s->saved_rect.width, s->saved_rect.height);
+     __fb_rect_io(ctx, fb, &s->saved_rect, s->saved, false);
+     __fb_sprite_paint(fb, s, &s->saved_rect, (uint8_t *)fb->address, &(dazzle_rect_t){0, 0, fb->width, fb->height}, fb->pitch);
+     return true;
+ }
+
+ bool dazzle_fb_hide_sprite(dazzle_context_t *ctx, dazzle_sprite_t *s)
+ {
+     if (!s->visible)
+         return true;
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+
+     if (s->on_screen)
+     {
+         dazzle_add_damage(ctx, s->saved_rect.x, s->saved_rect.y, s->saved_rect.width, s->saved_rect.height);
+         __fb_rect_io(ctx, fb, &s->saved_rect, s->saved, true);
+     }
+     s->visible = false;
+     s->on_screen = false;
+     return true;
+ }
+
+ bool dazzle_fb_move_sprite(dazzle_context_t *ctx, dazzle_sprite_t *s, int32_t x, int32_t y)
+ {
+     if (!s->visible)
+         return dazzle_fb_show_sprite(ctx, s, x, y);
+     if (x == s->x && y == s->y)
+         return true;
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+     uint32_t bypp = fb->bpp / 8;
+
+     dazzle_rect_t next;
+     bool next_on_screen = __fb_sprite_clip(fb, x, y, s->width, s->height, &next);
+
+     // Far jumps would turn the union into a large area, just redo it
+     dazzle_rect_t area = s->on_screen ? s->saved_rect : next;
+     if (s->on_screen && next_on_screen)
+         dazzle_rect_union(&area, &next);
+     uint64_t sprite_area = (uint64_t)s->width * s->height;
+     if (!s->on_screen || !next_on_screen || (uint64_t)area.width * area.height > 2 * sprite_area)
+     {
+         dazzle_fb_hide_sprite(ctx, s);
+         return dazzle_fb_show_sprite(ctx, s, x, y);
+     }
+
+     // Compose the union off-screen and write it once, so nothing flickers
+     size_t stride = (size_t)area.width * bypp;
+     uint8_t *scratch = __dazzle_malloc(ctx, stride * area.height);
+     if (scratch == NULL)
+         return false;
+
+     __fb_rect_io(ctx, fb, &area, scratch, false);
+
+     const uint8_t *saved = s->saved;
+     for (uint32_t j = 0; j < s->saved_rect.height; j++, saved += (size_t)s->saved_rect.width * bypp)
+         memcpy(scratch + (size_t)(s->saved_rect.y + j - area.y) * stride + (size_t)(s->saved_rect.x - area.x) * bypp, saved, (size_t)s->saved_rect.width * bypp);
+
+     uint8_t *keep = s->saved;
+     for (uint32_t j = 0; j < next.height; j++, keep += (size_t)next.width * bypp)
+         memcpy(keep, scratch + (size_t)(next.y + j - area.y) * stride + (size_t)(next.x - area.x) * bypp, (size_t)next.width * bypp);
+
+     s->x = x;
+     s->y = y;
+     s->saved_rect = next;
+     __fb_sprite_paint(fb, s, &next, scratch, &area, stride);
+     dazzle_add_damage(ctx, area.x, area.y, area.width, area.height);
+     __fb_rect_io(ctx, fb, &area, scratch, true);
+
+     __dazzle_free(ctx, scratch);
+     return true;
+ }
+
+ void dazzle_fb_destroy_sprite(dazzle_context_t *ctx, dazzle_sprite_t *s)
+ {
+     if (s == NULL)
+         return;
+     dazzle_fb_hide_sprite(ctx, s);
+     __dazzle_free(ctx, s);
+ }
  #endif
  
  #endif // __FRAMEBUF_INC_C__
\ No newline at end of file
@@ -0,0 +1,103 @@
+ #ifndef __MEMORY_INC_C__
+ #define __MEMORY_INC_C__
+
+ //======== Function Prototypes ========//
+
+ /*
+  * dazzle_init_memory(alloc,width,height,format) -> dazzle_context_t*
+  * Initializes a new Dazzle renderer drawing into an offscreen buffer it owns.
+  * format only supplies bpp, masks and shifts; NULL means 32bpp XRGB8888.
+  */
+ dazzle_context_t *dazzle_init_memory(dazzle_allocator_t alloc, uint32_t width, uint32_t height, const dazzle_framebuffer_t *format);
+
+ /*
+  * dazzle_memory_framebuffer(ctx) -> dazzle_framebuffer_t*
+  * The buffer a memory renderer draws into, to read its pixels back
+  */
+ dazzle_framebuffer_t *dazzle_memory_framebuffer(dazzle_context_t *ctx);
+
+ /*
+  * dazzle_memory_destroy(ctx)
+  * Frees a memory renderer together with its pixels
+  */
+ void dazzle_memory_destroy(dazzle_context_t *ctx);
+
+ //======== Function Implementations ========//
+ #ifdef __DAZZLE_IMPL__
+
+ dazzle_context_t *dazzle_init_memory(dazzle_allocator_t alloc, uint32_t width, uint32_t height, const dazzle_framebuffer_t *format)
+ {
+     if (width == 0 || height == 0)
+         return NULL;
+
+     dazzle_context_t *ctx = alloc.malloc(sizeof(dazzle_context_t));
+     if (ctx == NULL)
+         return NULL;
+
+     __dazzle_context_init(ctx, alloc);
+
+     dazzle_framebuffer_t *fb = alloc.malloc(sizeof(dazzle_framebuffer_t));
+     if (fb == NULL)
+     {
+         alloc.free(ctx);
+         return NULL;
+     }
+
+     if (format != NULL)
+     {
+         memcpy(fb, format, sizeof(dazzle_framebuffer_t));
+     }
+     else
+     {
+         memset(fb, 0, sizeof(dazzle_framebuffer_t));
+         fb->bpp = 32;
+         fb->red_mask = 0xFF;
+         fb->green_mask = 0xFF;
+         fb->blue_mask = 0xFF;
+         fb->alpha_mask = 0xFF;
+         fb->red_shift = 16;
+         fb->green_shift = 8;
+         fb->blue_shift = 0;
+         fb->alpha_shift = 24;
+     }
+
+     // Rows start on 64 byte boundaries so they never share a cache line
+     fb->width = width;
+     fb->height = height;
+     fb->pitch = ((width * (fb->bpp / 8)) + 63) & ~63u;
+     fb->address = (uintptr_t)alloc.malloc((size_t)fb->pitch * height);
+     if (fb->address == 0)
+     {
+         alloc.free(fb);
+         alloc.free(ctx);
+         return NULL;
+     }
+     memset((void *)fb->address, 0, (size_t)fb->pitch * height);
+
+     ctx->renderer_data = fb;
+     ctx->backend = __fb_backend(DAZZLE_CAP_FILL_SPAN | DAZZLE_CAP_FILL_RECT | DAZZLE_CAP_COPY_RECT | DAZZLE_CAP_BLIT | DAZZLE_CAP_BLEND | DAZZLE_CAP_READ_RECT | DAZZLE_CAP_DRAW_MONO | DAZZLE_CAP_DRAW_ALPHA | DAZZLE_CAP_CHEAP_READBACK);
+     ctx->backend.type = DAZZLE_RENDERER_TYPE_MEMORY;
+
+     return ctx;
+ }
+
+ dazzle_framebuffer_t *dazzle_memory_framebuffer(dazzle_context_t *ctx)
+ {
+     if (ctx->backend.type != DAZZLE_RENDERER_TYPE_MEMORY)
+         return NULL;
+     return (dazzle_framebuffer_t *)ctx->renderer_data;
+ }
+
+ void dazzle_memory_destroy(dazzle_context_t *ctx)
+ {
+     dazzle_framebuffer_t *fb = dazzle_memory_framebuffer(ctx);
+     if (fb == NULL)
+         return;
+
+     ctx->alloc.free((void *)fb->address);
+     ctx->alloc.free(fb);
+     ctx->alloc.free(ctx);
+ }
+ #endif
+
+ #endif // __MEMORY_INC_C__
@@ -0,0 +1,406 @@
+ #ifndef __CAPTURE_INC_C__
+ #define __CAPTURE_INC_C__
+
+ //======== Defines ========//
+ #define DAZZLE_CAPTURE_CHUNK 65536
+
+ //======== Structure Definitions ========//
+
+ /*
+  * Receives encoded bytes, returns false to abort the capture
+  */
+ typedef bool (*dazzle_capture_write_t)(void *user, const void *data, size_t len);
+
+ typedef struct
+ {
+     dazzle_allocator_t alloc;
+     uint32_t width;
+     uint32_t height;
+
+     // Last captured frame as dazzle colors, what deltas are taken against//
+     uint32_t *frame;
+
+     // One row each of device pixels, fresh colors and deltas//
+     uint8_t *devrow;
+     uint32_t *row;
+     uint32_t *delta;
+
+     // Encoder output, flushed to the writer whenever it fills up//
+     uint8_t *out;
+
+     uint32_t keyframe_interval;
+     uint32_t since_keyframe;
+     bool have_frame;
+ } dazzle_capture_t;
+
+ //======== Function Prototypes ========//
+
+ /*
+  * dazzle_capture_create(ctx,keyframe_interval) -> dazzle_capture_t*
+  * Prepares lossless QOI captures of ctx, which needs DAZZLE_CAP_READ_RECT.
+  * Every keyframe_interval-th frame is a full image (0 = only the first one).
+  */
+ dazzle_capture_t *dazzle_capture_create(dazzle_context_t *ctx, uint32_t keyframe_interval);
+
+ /*
+  * dazzle_capture_frame(cap,ctx,write,user,is_delta) -> bool
+  * Streams one frame to write as a QOI image. Only the region damaged since the
+  * previous capture is read back. Delta frames hold, per channel, the new value
+  * minus the previous capture modulo 256, so unchanged areas compress to runs;
+  * decode them as normal QOI and add them onto the previous frame.
+  * On DRM contexts capture after dazzle_drm_present, it reads the front buffer.
+  */
+ bool dazzle_capture_frame(dazzle_capture_t *cap, dazzle_context_t *ctx, dazzle_capture_write_t write, void *user, bool *is_delta);
+
+ /*
+  * dazzle_capture_destroy(cap)
+  * Frees a capture and its frame history
+  */
+ void dazzle_capture_destroy(dazzle_capture_t *cap);
+
+ //======== Function Implementations ========//
+ #ifdef __DAZZLE_IMPL__
+
+ //======== QOI encoder ========//
+ #define __QOI_OP_INDEX 0x00
+ #define __QOI_OP_DIFF 0x40
+ #define __QOI_OP_LUMA 0x80
+ #define __QOI_OP_RUN 0xc0
+ #define __QOI_OP_RGB 0xfe
+ #define __QOI_OP_RGBA 0xff
+
+ // Pixels are dazzle colors: r in the low byte, a in the high one
+ typedef struct
+ {
+     uint32_t index[64];
+     uint32_t prev;
+     uint32_t run;
+     uint8_t *buf;
+     size_t len;
+     dazzle_capture_write_t write;
+     void *user;
+     bool failed;
+ } __qoi_enc_t;
+
+ static void __qoi_flush(__qoi_enc_t *enc)
+ {
+     if (enc->len != 0 && !enc->failed && !enc->write(enc->user, enc->buf, enc->len))
+         enc->failed = true;
+     enc->len = 0;
+ }
+
+ static inline void __qoi_reserve(__qoi_enc_t *enc, size_t n)
+ {
+     if (enc->len + n > DAZZLE_CAPTURE_CHUNK)
+         __qoi_flush(enc);
+ }
+
+ static inline void __qoi_end_run(__qoi_enc_t *enc)
+ {
+     if (enc->run != 0)
+     {
+         __qoi_reserve(enc, 1);
+         enc->buf[enc->len++] = __QOI_OP_RUN | (enc->run - 1);
+         enc->run = 0;
+     }
+ }
+
+ // n more copies of the previous pixel
+ static inline void __qoi_repeat(__qoi_enc_t *enc, uint64_t n)
+ {
+     n += enc->run;
+     if (n >= 62)
+     {
+         uint64_t full = n / 62;
+         for (uint64_t i = 0; i < full; i++)
+         {
+             __qoi_reserve(enc, 1);
+             enc->buf[enc->len++] = __QOI_OP_RUN | 61;
+         }
+         n -= full * 62;
+     }
+     enc->run = (uint32_t)n;
+ }
+
+ static inline void __qoi_pixel(__qoi_enc_t *enc, uint32_t px)
+ {
+     if (px == enc->prev)
+     {
+         if (++enc->run == 62)
+         {
+             __qoi_reserve(enc, 1);
+             enc->buf[enc->len++] = __QOI_OP_RUN | 61;
+             enc->run = 0;
+         }
+         return;
+     }
+     __qoi_end_run(enc);
+     __qoi_reserve(enc, 5);
+
+     uint8_t r = px, g = px >> 8, b = px >> 16, a = px >> 24;
+     uint32_t h = (r * 3 + g * 5 + b * 7 + a * 11) % 64;
+     uint8_t *o = enc->buf + enc->len;
+
+     if (enc->index[h] == px)
+     {
+         *o++ = __QOI_OP_INDEX | h;
+     }
+     else
+     {
+         enc->index[h] = px;
+         if ((enc->prev >> 24) == a)
+         {
+             int8_t vr = (int8_t)(r - (uint8_t)enc->prev);
+             int8_t vg = (int8_t)(g - (uint8_t)(enc->prev >> 8));
+             int8_t vb = (int8_t)(b - (uint8_t)(enc->prev >> 16));
+             int8_t vg_r = vr - vg, vg_b = vb - vg;
+
+             if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2)
+             {
+                 *o++ = __QOI_OP_DIFF | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2);
+             }
+             else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8)
+             {
+                 *o++ = __QOI_OP_LUMA | (vg + 32);
+                 *o++ = (vg_r + 8) << 4 | (vg_b + 8);
+             }
+             else
+             {
+                 *o++ = __QOI_OP_RGB;
+                 *o++ = r;
+                 *o++ = g;
+                 *o++ = b;
+             }
+         }
+         else
+         {
+             *o++ = __QOI_OP_RGBA;
+             *o++ = r;
+             *o++ = g;
+             *o++ = b;
+             *o++ = a;
+         }
+     }
+     enc->len = o - enc->buf;
+     enc->prev = px;
+ }
+
+ static void __qoi_begin(__qoi_enc_t *enc, uint32_t width, uint32_t height)
+ {
+     uint8_t *o = enc->buf;
+     memcpy(o, "qoif", 4);
+     for (int i = 0; i < 4; i++)
+     {
+         o[4 + i] = width >> (24 - 8 * i);
+         o[8 + i] = height >> (24 - 8 * i);
+     }
+     o[12] = 3; // RGB, alpha is always opaque
+     o[13] = 0; // sRGB
+     enc->len = 14;
+ }
+
+ static void __qoi_finish(__qoi_enc_t *enc)
+ {
+     static const uint8_t padding[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+     __qoi_end_run(enc);
+     __qoi_reserve(enc, sizeof(padding));
+     memcpy(enc->buf + enc->len, padding, sizeof(padding));
+     enc->len += sizeof(padding);
+     __qoi_flush(enc);
+ }
+
+ //======== Pixel conversion ========//
+
+ // Device pixels to opaque dazzle colors
+ static void __capture_convert(dazzle_framebuffer_t *fb, const uint8_t *src, uint32_t *dst, uint32_t n)
+ {
+     uint32_t bypp = fb->bpp / 8;
+     uint32_t i = 0;
+
+     if (bypp == 4)
+     {
+ #ifdef DAZZLE_SIMD_SSE2
+         const __m128i sr = _mm_cvtsi32_si128(fb->red_shift), sg = _mm_cvtsi32_si128(fb->green_shift), sb = _mm_cvtsi32_si128(fb->blue_shift);
+         const __m128i mr = _mm_set1_epi32(fb->red_mask), mg = _mm_set1_epi32(fb->green_mask), mb = _mm_set1_epi32(fb->blue_mask);
+         const __m128i opaque = _mm_set1_epi32((int32_t)0xFF000000);
+         for (; i + 4 <= n; i += 4)
+         {
+             __m128i v = _mm_loadu_si128((const __m128i *)(src + i * 4));
+             __m128i r = _mm_and_si128(_mm_srl_epi32(v, sr), mr);
+             __m128i g = _mm_slli_epi32(_mm_and_si128(_mm_srl_epi32(v, sg), mg), 8);
+             __m128i b = _mm_slli_epi32(_mm_and_si128(_mm_srl_epi32(v, sb), mb), 16);
+             _mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, opaque)));
+         }
+ #endif
+         for (; i < n; i++)
+             dst[i] = (uint32_t)__unconvert_color(fb, ((const uint32_t *)src)[i]) | 0xFF000000;
+         return;
+     }
+
+     for (; i < n; i++)
+     {
+         uint64_t px = 0;
+         memcpy(&px, src + i * bypp, bypp);
+         dst[i] = (uint32_t)__unconvert_color(fb, px) | 0xFF000000;
+     }
+ }
+
+ // delta = now - before per color channel, alpha stays opaque so "no change" is the QOI start pixel
+ static void __capture_delta(const uint32_t *now, const uint32_t *before, uint32_t *delta, uint32_t n)
+ {
+     uint32_t i = 0;
+ #ifdef DAZZLE_SIMD_SSE2
+     const __m128i opaque = _mm_set1_epi32((int32_t)0xFF000000);
+     for (; i + 4 <= n; i += 4)
+     {
+         __m128i a = _mm_loadu_si128((const __m128i *)(now + i));
+         __m128i b = _mm_loadu_si128((const __m128i *)(before + i));
+         _mm_storeu_si128((__m128i *)(delta + i), _mm_or_si128(_mm_sub_epi8(a, b), opaque));
+     }
+ #endif
+     for (; i < n; i++)
+     {
+         uint32_t a = now[i], b = before[i];
+         uint32_t d = ((a & 0xFF) - (b & 0xFF)) & 0xFF;
+         d |= ((((a >> 8) & 0xFF) - ((b >> 8) & 0xFF)) & 0xFF) << 8;
+         d |= ((((a >> 16) & 0xFF) - ((b >> 16) & 0xFF)) & 0xFF) << 16;
+         delta[i] = d | 0xFF000000;
+     }
+ }
+
+ //======== Capture ========//
+
+ dazzle_capture_t *dazzle_capture_create(dazzle_context_t *ctx, uint32_t keyframe_interval)
+ {
+     if (ctx->renderer_data == NULL || ctx->backend.read_rect == NULL)
+         return NULL;
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+
+     dazzle_capture_t *cap = ctx->alloc.malloc(sizeof(dazzle_capture_t));
+     if (cap == NULL)
+         return NULL;
+     memset(cap, 0, sizeof(dazzle_capture_t));
+
+     cap->alloc = ctx->alloc;
+     cap->width = fb->width;
+     cap->height = fb->height;
+     cap->keyframe_interval = keyframe_interval;
+
+     size_t pixels = (size_t)fb->width * fb->height;
+     cap->frame = cap->alloc.malloc(pixels * sizeof(uint32_t));
+     cap->devrow = cap->alloc.malloc((size_t)fb->width * (fb->bpp / 8));
+     cap->row = cap->alloc.malloc((size_t)fb->width * sizeof(uint32_t));
+     cap->delta = cap->alloc.malloc((size_t)fb->width * sizeof(uint32_t));
+     cap->out = cap->alloc.malloc(DAZZLE_CAPTURE_CHUNK);
+
+     if (cap->frame == NULL || cap->devrow == NULL || cap->row == NULL || cap->delta == NULL || cap->out == NULL)
+     {
+         dazzle_capture_destroy(cap);
+         return NULL;
+     }
+     return cap;
+ }
+
+ bool dazzle_capture_frame(dazzle_capture_t *cap, dazzle_context_t *ctx, dazzle_capture_write_t write, void *user, bool *is_delta)
+ {
+     DAZZLE_TRACE_SCOPE("capture_frame");
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+     if (fb == NULL || write == NULL || fb->width != cap->width || fb->height != cap->height)
+         return false;
+
+     // Clip what changed since last time to the screen
+     dazzle_rect_t dmg = dazzle_take_damage(ctx);
+     if (dmg.x >= cap->width || dmg.y >= cap->height)
+         dmg.width = dmg.height = 0;
+     if (dmg.width > cap->width - dmg.x)
+         dmg.width = cap->width - dmg.x;
+     if (dmg.height > cap->height - dmg.y)
+         dmg.height = cap->height - dmg.y;
+
+     bool key = !cap->have_frame || (cap->keyframe_interval != 0 && cap->since_keyframe + 1 >= cap->keyframe_interval);
+     if (key)
+         dmg = (dazzle_rect_t){0, 0, cap->width, cap->height};
+
+     __qoi_enc_t enc;
+     memset(enc.index, 0, sizeof(enc.index));
+     enc.prev = 0xFF000000;
+     enc.run = 0;
+     enc.buf = cap->out;
+     enc.write = write;
+     enc.user = user;
+     enc.failed = false;
+     __qoi_begin(&enc, cap->width, cap->height);
+
+     for (uint32_t y = 0; y < cap->height && !enc.failed; y++)
+     {
+         uint32_t *stored = cap->frame + (size_t)y * cap->width;
+
+         if (y < dmg.y || y >= dmg.y + dmg.height)
+         {
+             // Untouched row, a delta of zero (never reached for keyframes)
+             if (enc.prev != 0xFF000000)
+                 __qoi_pixel(&enc, 0xFF000000), __qoi_repeat(&enc, cap->width - 1);
+             else
+                 __qoi_repeat(&enc, cap->width);
+             continue;
+         }
+
+         if (!dazzle_read_rect(ctx, dmg.x, y, dmg.width, 1, cap->devrow, dmg.width * (fb->bpp / 8)))
+         {
+             cap->have_frame = false; // history is now unreliable
+             return false;
+         }
+         __capture_convert(fb, cap->devrow, cap->row, dmg.width);
+
+         if (key)
+         {
+             memcpy(stored, cap->row, (size_t)cap->width * sizeof(uint32_t));
+             for (uint32_t x = 0; x < cap->width; x++)
+                 __qoi_pixel(&enc, stored[x]);
+             continue;
+         }
+
+         __capture_delta(cap->row, stored + dmg.x, cap->delta, dmg.width);
+         memcpy(stored + dmg.x, cap->row, (size_t)dmg.width * sizeof(uint32_t));
+
+         for (uint32_t x = 0; x < dmg.x; x++)
+             __qoi_pixel(&enc, 0xFF000000);
+         for (uint32_t x = 0; x < dmg.width; x++)
+             __qoi_pixel(&enc, cap->delta[x]);
+         for (uint32_t x = dmg.x + dmg.width; x < cap->width; x++)
+             __qoi_pixel(&enc, 0xFF000000);
+     }
+
+     __qoi_finish(&enc);
+     if (enc.failed)
+     {
+         cap->have_frame = false;
+         return false;
+     }
+
+     cap->have_frame = true;
+     cap->since_keyframe = key ? 0 : cap->since_keyframe + 1;
+     if (is_delta != NULL)
+         *is_delta = !key;
+     return true;
+ }
+
+ void dazzle_capture_destroy(dazzle_capture_t *cap)
+ {
+     if (cap == NULL)
+         return;
+     if (cap->frame != NULL)
+         cap->alloc.free(cap->frame);
+     if (cap->devrow != NULL)
+         cap->alloc.free(cap->devrow);
+     if (cap->row != NULL)
+         cap->alloc.free(cap->row);
+     if (cap->delta != NULL)
+         cap->alloc.free(cap->delta);
+     if (cap->out != NULL)
+         cap->alloc.free(cap->out);
+     cap->alloc.free(cap);
+ }
+ #endif
+
+ #endif // __CAPTURE_INC_C__
@@ -5,6 +5,19 @@
 #include <stdbool.h>
 #include <string.h>
 
+#if defined(__SSE2__) && !defined(DAZZLE_NO_SIMD)
+    #include <emmintrin.h>
+    #define DAZZLE_SIMD_SSE2 1
+#endif
+
+//Counters are on unless DAZZLE_NO_STATS is defined, which compiles every bit of them out//
+#ifndef DAZZLE_NO_STATS
+    #define DAZZLE_STATS 1
+    #define __DAZZLE_STAT(ctx, field, n) ((ctx)->stats.field += (n))
+#else
+    #define __DAZZLE_STAT(ctx, field, n) ((void)0)
+#endif
+
 //======== Basic Information ========//
 #define DAZZLE_VERSION_MAJOR 0
 #define DAZZLE_VERSION_MINOR 0
@@ -12,12 +25,30 @@
 
 //======== Defines ========//
 #define DAZZLE_RENDERER_TYPE_FRAMEBUFFER 0
+#define DAZZLE_RENDERER_TYPE_MEMORY 1
+#define DAZZLE_RENDERER_TYPE_DRM 2
+
+//Backend capabilities, each one means the matching hook is implemented//
+#define DAZZLE_CAP_FILL_SPAN (1 << 0)
+#define DAZZLE_CAP_FILL_RECT (1 << 1)
+#define DAZZLE_CAP_COPY_RECT (1 << 2)
+#define DAZZLE_CAP_BLIT (1 << 3)
+#define DAZZLE_CAP_BLEND (1 << 4)
+#define DAZZLE_CAP_CHEAP_READBACK (1 << 5) // target is cached memory, reading pixels back costs nothing special
+#define DAZZLE_CAP_READ_RECT (1 << 6)
+#define DAZZLE_CAP_DRAW_MONO (1 << 7)
+#define DAZZLE_CAP_DRAW_ALPHA (1 << 8)
 
 #define DAZZLE_RETAINED_TRIANGLE 0
 #define DAZZLE_RETAINED_RECTANGLE 1
 #define DAZZLE_RETAINED_QUAD 2
 #define DAZZLE_RETAINED_CIRCLE 3
 #define DAZZLE_RETAINED_BLITABLE 4
+#define DAZZLE_RETAINED_SCALED_BLITABLE 5
+#define DAZZLE_RETAINED_TYPE_COUNT 6
+
+#define DAZZLE_FILTER_NEAREST 0
+#define DAZZLE_FILTER_BILINEAR 1
 
 
 //======== Structure Definitions ========//
@@ -26,6 +57,13 @@ typedef struct {
     void (*free)(void* ptr);
 } dazzle_allocator_t;
 
+typedef struct {
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+} dazzle_rect_t;
+
 typedef struct retained {
     uint8_t type;
     union {
@@ -72,25 +110,89 @@ typedef struct retained {
             uint32_t width;
             uint32_t height;
             bool translated;
+            uint32_t stride; // bytes per row once translated
             void* buffer;
         } blit;
+        struct {
+            uint32_t x;
+            uint32_t y;
+            uint32_t width;
+            uint32_t height;
+            uint32_t src_width;
+            uint32_t src_height;
+            uint8_t filter;
+            bool translated;
+            void* buffer;
+        } scaled_blit;
     } type_data;
     struct retained* next;
 } dazzle_retained_element_t;
 
+struct dazzle_context_t;
+
+typedef struct {
+    uint64_t elements[DAZZLE_RETAINED_TYPE_COUNT]; // drawn, indexed by DAZZLE_RETAINED_*
+    uint64_t spans;
+    uint64_t pixels; // written, after clipping
+    uint64_t bytes_copied; // blits, copies and readbacks
+    uint64_t alloc_calls;
+    uint64_t alloc_bytes;
+    uint64_t free_calls;
+    uint64_t blit_translations; // blitables converted to device pixels
+    uint64_t clears;
+    uint64_t clear_ns;
+    uint64_t redraws;
+    uint64_t redraw_ns;
+} dazzle_stats_t;
+
+/*
+ * Colors are always dazzle colors (0xAABBGGRR) unless noted otherwise.
+ * blit takes pixels already in the device format (see dazzle_map_color),
+ * blend takes dazzle colors and uses their alpha. read_rect returns device
+ * pixels of what is (or will next be) on screen. draw_mono paints a 1bpp
+ * bitmap, most significant bit first: set bits get fg, clear bits get bg
+ * unless bg has zero alpha. draw_alpha paints color through an 8-bit
+ * coverage mask, scaled by the color's own alpha. Strides are in bytes.
+ */
+typedef struct {
+    uint8_t type;
+    uint32_t caps;
+
+    //Required//
+    bool (*draw_element)(struct dazzle_context_t* ctx, dazzle_retained_element_t* element);
+    bool (*clear)(struct dazzle_context_t* ctx, uint64_t color);
+    uint64_t (*map_color)(struct dazzle_context_t* ctx, uint64_t color);
+
+    //Optional fast paths, NULL when missing//
+    bool (*fill_span)(struct dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint64_t color);
+    bool (*fill_rect)(struct dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint64_t color);
+    bool (*copy_rect)(struct dazzle_context_t* ctx, uint32_t dst_x, uint32_t dst_y, uint32_t src_x, uint32_t src_y, uint32_t width, uint32_t height);
+    bool (*blit)(struct dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* pixels, uint32_t stride);
+    bool (*blend)(struct dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint32_t* pixels, uint32_t stride);
+    bool (*read_rect)(struct dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, void* pixels, uint32_t stride);
+    bool (*draw_mono)(struct dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* bits, uint32_t stride, uint64_t fg, uint64_t bg);
+    bool (*draw_alpha)(struct dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* alpha, uint32_t stride, uint64_t color);
+} dazzle_backend_t;
+
 typedef struct dazzle_context_t {
     //Required stuff//
     dazzle_allocator_t alloc;
 
     //Renderer functions//
-    bool (*draw_element)(struct dazzle_context_t* ctx, dazzle_retained_element_t* element);
-    bool (*clear)(struct dazzle_context_t* ctx, uint64_t color);
+    dazzle_backend_t backend;
 
     //Retained state//
     uint32_t retained_count;
     dazzle_retained_element_t* retained;
     dazzle_retained_element_t* last;
 
+    //Everything touched since the last dazzle_take_damage, clipped by the consumer//
+    dazzle_rect_t damage;
+
+#ifdef DAZZLE_STATS
+    dazzle_stats_t stats;
+#endif
+
     //Renderer data//
     void* renderer_data;
 } dazzle_context_t;
@@ -100,29 +202,245 @@ typedef struct dazzle_context_t {
 bool dazzle_clear(dazzle_context_t* ctx, uint64_t color);
 bool dazzle_draw(dazzle_context_t* ctx, dazzle_retained_element_t* element);
 
+//Primitives, routed to the backend's fast paths when it has them//
+uint32_t dazzle_caps(dazzle_context_t* ctx);
+uint64_t dazzle_map_color(dazzle_context_t* ctx, uint64_t color);
+bool dazzle_fill_span(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint64_t color);
+bool dazzle_fill_rect(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint64_t color);
+bool dazzle_copy_rect(dazzle_context_t* ctx, uint32_t dst_x, uint32_t dst_y, uint32_t src_x, uint32_t src_y, uint32_t width, uint32_t height);
+bool dazzle_blit(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* pixels, uint32_t stride);
+bool dazzle_blend(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint32_t* pixels, uint32_t stride);
+bool dazzle_read_rect(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, void* pixels, uint32_t stride);
+bool dazzle_draw_mono(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* bits, uint32_t stride, uint64_t fg, uint64_t bg);
+bool dazzle_draw_alpha(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* alpha, uint32_t stride, uint64_t color);
+
+//Damage tracking//
+void dazzle_add_damage(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+dazzle_rect_t dazzle_take_damage(dazzle_context_t* ctx);
+
 //Element creation//
 dazzle_retained_element_t* dazzle_create_triangle(dazzle_context_t* ctx, uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, uint32_t x3, uint32_t y3,bool filled,uint64_t color);
 dazzle_retained_element_t* dazzle_create_rectangle(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height,bool filled,uint64_t color);
 dazzle_retained_element_t* dazzle_create_circle(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t radius,bool filled,uint64_t color);
 dazzle_retained_element_t* dazzle_create_blitable(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, void* buffer);
+dazzle_retained_element_t* dazzle_create_scaled_blitable(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t src_width, uint32_t src_height, void* buffer, uint8_t filter);
 
 //Retained rendering//
 bool dazzle_redraw(dazzle_context_t* ctx);
 bool dazzle_add(dazzle_context_t* ctx, dazzle_retained_element_t* element);
 
+//Stats, get_stats returns false when they are compiled out//
+bool dazzle_get_stats(dazzle_context_t* ctx, dazzle_stats_t* out);
+void dazzle_reset_stats(dazzle_context_t* ctx);
+
+//Geometry helpers//
+bool dazzle_element_bounds(dazzle_retained_element_t* element, dazzle_rect_t* out);
+void dazzle_rect_union(dazzle_rect_t* dst, const dazzle_rect_t* src);
+
+//======== Tracing ========//
+#include "trace.inc.c"
+
 //======== Function Implementations ========//
 #ifdef __DAZZLE_IMPL__
 
+void __dazzle_context_init(dazzle_context_t* ctx, dazzle_allocator_t alloc){
+    memset(ctx, 0, sizeof(dazzle_context_t));
+    ctx->alloc = alloc;
+}
+
+// Allocations made on behalf of a context, so the stats can see them
+static inline void* __dazzle_malloc(dazzle_context_t* ctx, size_t size){
+    __DAZZLE_STAT(ctx,alloc_calls,1);
+    __DAZZLE_STAT(ctx,alloc_bytes,size);
+    return ctx->alloc.malloc(size);
+}
+
+static inline void __dazzle_free(dazzle_context_t* ctx, void* p){
+    __DAZZLE_STAT(ctx,free_calls,1);
+    ctx->alloc.free(p);
+}
+
+// Sends an element to the cheapest primitive that can draw it
+static inline bool __dazzle_route(dazzle_context_t* ctx, dazzle_retained_element_t* e){
+    if(e->type < DAZZLE_RETAINED_TYPE_COUNT)
+        __DAZZLE_STAT(ctx,elements[e->type],1);
+
+    dazzle_rect_t bounds;
+    if(dazzle_element_bounds(e,&bounds))
+        dazzle_rect_union(&ctx->damage,&bounds);
+
+    switch(e->type){
+        case DAZZLE_RETAINED_RECTANGLE:
+            if(e->type_data.rect.filled && ctx->backend.fill_rect != NULL)
+                return ctx->backend.fill_rect(ctx, e->type_data.rect.x, e->type_data.rect.y, e->type_data.rect.width, e->type_data.rect.height, e->type_data.rect.color);
+            break;
+        case DAZZLE_RETAINED_BLITABLE:
+            // Only once the backend translated it to device pixels
+            if(e->type_data.blit.translated && ctx->backend.blit != NULL)
+                return ctx->backend.blit(ctx, e->type_data.blit.x, e->type_data.blit.y, e->type_data.blit.width, e->type_data.blit.height,
+                                         e->type_data.blit.buffer, e->type_data.blit.stride);
+            break;
+    }
+    return ctx->backend.draw_element(ctx,e);
+}
+
 bool dazzle_clear(dazzle_context_t* ctx, uint64_t color){
-    return ctx->clear(ctx,color);
+    DAZZLE_TRACE_SCOPE("dazzle_clear");
+    dazzle_add_damage(ctx,0,0,UINT32_MAX,UINT32_MAX);
+#ifdef DAZZLE_STATS
+    uint64_t start = __dazzle_now_ns();
+    bool ok = ctx->backend.clear(ctx,color);
+    ctx->stats.clears++;
+    ctx->stats.clear_ns += __dazzle_now_ns() - start;
+    return ok;
+#else
+    return ctx->backend.clear(ctx,color);
+#endif
 }
 
 bool dazzle_draw(dazzle_context_t* ctx, dazzle_retained_element_t* element){
-    return ctx->draw_element(ctx,element);
+    return __dazzle_route(ctx,element);
+}
+
+uint32_t dazzle_caps(dazzle_context_t* ctx){
+    return ctx->backend.caps;
+}
+
+uint64_t dazzle_map_color(dazzle_context_t* ctx, uint64_t color){
+    return ctx->backend.map_color != NULL ? ctx->backend.map_color(ctx,color) : color;
+}
+
+bool dazzle_fill_span(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint64_t color){
+    dazzle_add_damage(ctx,x,y,width,1);
+    if(ctx->backend.fill_span != NULL)
+        return ctx->backend.fill_span(ctx,x,y,width,color);
+    return dazzle_fill_rect(ctx,x,y,width,1,color);
+}
+
+bool dazzle_fill_rect(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint64_t color){
+    dazzle_add_damage(ctx,x,y,width,height);
+    if(ctx->backend.fill_rect != NULL)
+        return ctx->backend.fill_rect(ctx,x,y,width,height,color);
+
+    if(ctx->backend.fill_span != NULL){
+        bool success = true;
+        for(uint32_t i = 0; i < height; i++)
+            success &= ctx->backend.fill_span(ctx,x,y + i,width,color);
+        return success;
+    }
+
+    dazzle_retained_element_t e = {0};
+    e.type = DAZZLE_RETAINED_RECTANGLE;
+    e.type_data.rect.x = x;
+    e.type_data.rect.y = y;
+    e.type_data.rect.width = width;
+    e.type_data.rect.height = height;
+    e.type_data.rect.filled = true;
+    e.type_data.rect.color = color;
+    return ctx->backend.draw_element(ctx,&e);
+}
+
+bool dazzle_copy_rect(dazzle_context_t* ctx, uint32_t dst_x, uint32_t dst_y, uint32_t src_x, uint32_t src_y, uint32_t width, uint32_t height){
+    if(ctx->backend.copy_rect == NULL) return false;
+    dazzle_add_damage(ctx,dst_x,dst_y,width,height);
+    return ctx->backend.copy_rect(ctx,dst_x,dst_y,src_x,src_y,width,height);
+}
+
+bool dazzle_blit(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* pixels, uint32_t stride){
+    if(ctx->backend.blit == NULL) return false;
+    dazzle_add_damage(ctx,x,y,width,height);
+    return ctx->backend.blit(ctx,x,y,width,height,pixels,stride);
+}
+
+bool dazzle_blend(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint32_t* pixels, uint32_t stride){
+    if(ctx->backend.blend == NULL) return false;
+    dazzle_add_damage(ctx,x,y,width,height);
+    return ctx->backend.blend(ctx,x,y,width,height,pixels,stride);
+}
+
+bool dazzle_read_rect(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, void* pixels, uint32_t stride){
+    if(ctx->backend.read_rect == NULL) return false;
+    return ctx->backend.read_rect(ctx,x,y,width,height,pixels,stride);
+}
+
+bool dazzle_draw_mono(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* bits, uint32_t stride, uint64_t fg, uint64_t bg){
+    if(bits == NULL) return false;
+    dazzle_add_damage(ctx,x,y,width,height);
+    if(ctx->backend.draw_mono != NULL)
+        return ctx->backend.draw_mono(ctx,x,y,width,height,bits,stride,fg,bg);
+
+    //One span per run of equal bits//
+    bool success = true;
+    bool opaque = (bg >> 24) != 0;
+    for(uint32_t i = 0; i < height; i++, bits += stride){
+        uint32_t j = 0;
+        while(j < width){
+            bool set = bits[j / 8] & (0x80 >> (j % 8));
+            uint32_t start = j;
+            while(j < width && (bool)(bits[j / 8] & (0x80 >> (j % 8))) == set) j++;
+            if(set || opaque)
+                success &= dazzle_fill_span(ctx,x + start,y + i,j - start,set ? fg : bg);
+        }
+    }
+    return success;
+}
+
+bool dazzle_draw_alpha(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* alpha, uint32_t stride, uint64_t color){
+    if(alpha == NULL) return false;
+    dazzle_add_damage(ctx,x,y,width,height);
+    if(ctx->backend.draw_alpha != NULL)
+        return ctx->backend.draw_alpha(ctx,x,y,width,height,alpha,stride,color);
+    if(ctx->backend.blend == NULL) return false;
+
+    //Rows of colored pixels through blend, a chunk at a time//
+    uint32_t chunk[64];
+    uint32_t rgb = (uint32_t)color & 0xFFFFFF, a = (uint32_t)(color >> 24) & 0xFF;
+    bool success = true;
+    for(uint32_t i = 0; i < height; i++, alpha += stride){
+        for(uint32_t j = 0; j < width; j += 64){
+            uint32_t n = width - j < 64 ? width - j : 64;
+            for(uint32_t k = 0; k < n; k++)
+                chunk[k] = rgb | (alpha[j + k] * a + 127) / 255 << 24;
+            success &= ctx->backend.blend(ctx,x + j,y + i,n,1,chunk,n * 4);
+        }
+    }
+    return success;
+}
+
+void dazzle_add_damage(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height){
+    dazzle_rect_t r = {x, y, width, height};
+    if(width > UINT32_MAX - x) r.width = UINT32_MAX - x;
+    if(height > UINT32_MAX - y) r.height = UINT32_MAX - y;
+    dazzle_rect_union(&ctx->damage,&r);
+}
+
+dazzle_rect_t dazzle_take_damage(dazzle_context_t* ctx){
+    dazzle_rect_t r = ctx->damage;
+    ctx->damage = (dazzle_rect_t){0, 0, 0, 0};
+    return r;
+}
+
+bool dazzle_get_stats(dazzle_context_t* ctx, dazzle_stats_t* out){
+#ifdef DAZZLE_STATS
+    *out = ctx->stats;
+    return true;
+#else
+    (void)ctx;
+    memset(out,0,sizeof(dazzle_stats_t));
+    return false;
+#endif
+}
+
+void dazzle_reset_stats(dazzle_context_t* ctx){
+#ifdef DAZZLE_STATS
+    memset(&ctx->stats,0,sizeof(dazzle_stats_t));
+#else
+    (void)ctx;
+#endif
 }
 
 dazzle_retained_element_t* dazzle_create_triangle(dazzle_context_t* ctx, uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, uint32_t x3, uint32_t y3,bool filled,uint64_t color){
-    dazzle_retained_element_t* e = ctx->alloc.malloc(sizeof(dazzle_retained_element_t));
+    dazzle_retained_element_t* e = __dazzle_malloc(ctx,sizeof(dazzle_retained_element_t));
 
     if(e == NULL) return false;
 
@@ -141,7 +459,7 @@ dazzle_retained_element_t* dazzle_create_triangle(dazzle_context_t* ctx, uint32_
 }
 
 dazzle_retained_element_t* dazzle_create_rectangle(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height,bool filled,uint64_t color){
-    dazzle_retained_element_t* e = ctx->alloc.malloc(sizeof(dazzle_retained_element_t));
+    dazzle_retained_element_t* e = __dazzle_malloc(ctx,sizeof(dazzle_retained_element_t));
 
     if(e == NULL) return false;
 
@@ -158,7 +476,7 @@ dazzle_retained_element_t* dazzle_create_rectangle(dazzle_context_t* ctx, uint32
 }
 
 dazzle_retained_element_t* dazzle_create_circle(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t radius,bool filled,uint64_t color){
-    dazzle_retained_element_t* e = ctx->alloc.malloc(sizeof(dazzle_retained_element_t));
+    dazzle_retained_element_t* e = __dazzle_malloc(ctx,sizeof(dazzle_retained_element_t));
 
     if(e == NULL) return false;
 
@@ -174,7 +492,7 @@ dazzle_retained_element_t* dazzle_create_circle(dazzle_context_t* ctx, uint32_t
 }
 
 dazzle_retained_element_t* dazzle_create_blitable(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, void* buffer){
-    dazzle_retained_element_t* e = ctx->alloc.malloc(sizeof(dazzle_retained_element_t));
+    dazzle_retained_element_t* e = __dazzle_malloc(ctx,sizeof(dazzle_retained_element_t));
 
     if(e == NULL) return false;
 
@@ -183,19 +501,51 @@ dazzle_retained_element_t* dazzle_create_blitable(dazzle_context_t* ctx, uint32_
     e->type_data.blit.y = y;
     e->type_data.blit.width = width;
     e->type_data.blit.height = height;
+    e->type_data.blit.translated = false;
+    e->type_data.blit.stride = 0;
     e->type_data.blit.buffer = buffer;
     e->next = NULL;
 
     return e;
 }
 
+dazzle_retained_element_t* dazzle_create_scaled_blitable(dazzle_context_t* ctx, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t src_width, uint32_t src_height, void* buffer, uint8_t filter){
+    if(src_width == 0 || src_height == 0) return NULL;
+
+    dazzle_retained_element_t* e = __dazzle_malloc(ctx,sizeof(dazzle_retained_element_t));
+
+    if(e == NULL) return NULL;
+
+    e->type = DAZZLE_RETAINED_SCALED_BLITABLE;
+    e->type_data.scaled_blit.x = x;
+    e->type_data.scaled_blit.y = y;
+    e->type_data.scaled_blit.width = width;
+    e->type_data.scaled_blit.height = height;
+    e->type_data.scaled_blit.src_width = src_width;
+    e->type_data.scaled_blit.src_height = src_height;
+    e->type_data.scaled_blit.filter = filter;
+    e->type_data.scaled_blit.translated = false;
+    e->type_data.scaled_blit.buffer = buffer;
+    e->next = NULL;
+
+    return e;
+}
+
 bool dazzle_redraw(dazzle_context_t* ctx){
+    DAZZLE_TRACE_SCOPE("dazzle_redraw");
+#ifdef DAZZLE_STATS
+    uint64_t start = __dazzle_now_ns();
+#endif
     dazzle_retained_element_t* e = ctx->retained;
     bool success = true;
     while(e != NULL){
-        success &= ctx->draw_element(ctx,e);
+        success &= __dazzle_route(ctx,e);
         e = e->next;
     }
+#ifdef DAZZLE_STATS
+    ctx->stats.redraws++;
+    ctx->stats.redraw_ns += __dazzle_now_ns() - start;
+#endif
     return success;
 }
 bool dazzle_add(dazzle_context_t* ctx, dazzle_retained_element_t* e){
@@ -207,11 +557,97 @@ bool dazzle_add(dazzle_context_t* ctx, dazzle_retained_element_t* e){
         ctx->last = e;
     }
     ctx->retained_count++;
+    return true;
+}
+
+bool dazzle_element_bounds(dazzle_retained_element_t* e, dazzle_rect_t* out){
+    int64_t x0, y0, x1, y1; // inclusive-exclusive box, may start off-screen
+
+    switch(e->type){
+        case DAZZLE_RETAINED_TRIANGLE:
+            x0 = x1 = e->type_data.triangle.x1;
+            y0 = y1 = e->type_data.triangle.y1;
+            if(e->type_data.triangle.x2 < x0) x0 = e->type_data.triangle.x2;
+            if(e->type_data.triangle.x3 < x0) x0 = e->type_data.triangle.x3;
+            if(e->type_data.triangle.x2 > x1) x1 = e->type_data.triangle.x2;
+            if(e->type_data.triangle.x3 > x1) x1 = e->type_data.triangle.x3;
+            if(e->type_data.triangle.y2 < y0) y0 = e->type_data.triangle.y2;
+            if(e->type_data.triangle.y3 < y0) y0 = e->type_data.triangle.y3;
+            if(e->type_data.triangle.y2 > y1) y1 = e->type_data.triangle.y2;
+            if(e->type_data.triangle.y3 > y1) y1 = e->type_data.triangle.y3;
+            x1++; y1++;
+            break;
+        case DAZZLE_RETAINED_RECTANGLE:
+            x0 = e->type_data.rect.x;
+            y0 = e->type_data.rect.y;
+            x1 = x0 + e->type_data.rect.width;
+            y1 = y0 + e->type_data.rect.height;
+            break;
+        case DAZZLE_RETAINED_CIRCLE:
+            x0 = (int64_t)e->type_data.circle.x - e->type_data.circle.radius;
+            y0 = (int64_t)e->type_data.circle.y - e->type_data.circle.radius;
+            x1 = (int64_t)e->type_data.circle.x + e->type_data.circle.radius + 1;
+            y1 = (int64_t)e->type_data.circle.y + e->type_data.circle.radius + 1;
+            break;
+        case DAZZLE_RETAINED_BLITABLE:
+            x0 = e->type_data.blit.x;
+            y0 = e->type_data.blit.y;
+            x1 = x0 + e->type_data.blit.width;
+            y1 = y0 + e->type_data.blit.height;
+            break;
+        case DAZZLE_RETAINED_SCALED_BLITABLE:
+            x0 = e->type_data.scaled_blit.x;
+            y0 = e->type_data.scaled_blit.y;
+            x1 = x0 + e->type_data.scaled_blit.width;
+            y1 = y0 + e->type_data.scaled_blit.height;
+            break;
+        default:
+            return false;
+    }
+
+    if(x0 < 0) x0 = 0;
+    if(y0 < 0) y0 = 0;
+    if(x1 > UINT32_MAX) x1 = UINT32_MAX;
+    if(y1 > UINT32_MAX) y1 = UINT32_MAX;
+    if(x1 <= x0 || y1 <= y0) return false;
+
+    out->x = (uint32_t)x0;
+    out->y = (uint32_t)y0;
+    out->width = (uint32_t)(x1 - x0);
+    out->height = (uint32_t)(y1 - y0);
+    return true;
+}
+
+void dazzle_rect_union(dazzle_rect_t* dst, const dazzle_rect_t* src){
+    if(src->width == 0 || src->height == 0) return;
+    if(dst->width == 0 || dst->height == 0){
+        *dst = *src;
+        return;
+    }
+    uint64_t x1 = dst->x + (uint64_t)dst->width, y1 = dst->y + (uint64_t)dst->height;
+    uint64_t sx1 = src->x + (uint64_t)src->width, sy1 = src->y + (uint64_t)src->height;
+    if(src->x < dst->x) dst->x = src->x;
+    if(src->y < dst->y) dst->y = src->y;
+    if(sx1 > x1) x1 = sx1;
+    if(sy1 > y1) y1 = sy1;
+    dst->width = (uint32_t)(x1 - dst->x);
+    dst->height = (uint32_t)(y1 - dst->y);
 }
 
 #endif
 
 //======== Backend inclusions ========//
 #include "backends/framebuf.inc.c"
+#include "backends/memory.inc.c"
+
+// Needs libdrm, define DAZZLE_BACKEND_DRM before including dazzle.h to enable
+#ifdef DAZZLE_BACKEND_DRM
+    #include "backends/drm.inc.c"
+#endif
+
+//======== Extras ========//
+#include "image.inc.c"
+#include "group.inc.c"
+#include "capture.inc.c"
 
 #endif // __DAZZLE_H__
\ No newline at end of file
@@ -0,0 +1,187 @@
+ #ifndef __GROUP_INC_C__
+ #define __GROUP_INC_C__
+
+ #include <pthread.h>
+
+ //======== Structure Definitions ========//
+
+ /*
+  * Renders one output of a group, runs on that output's own thread
+  */
+ typedef bool (*dazzle_group_fn)(dazzle_context_t *ctx, uint32_t index, void *user);
+
+ struct dazzle_group;
+
+ typedef struct
+ {
+     struct dazzle_group *group;
+     uint32_t index;
+     pthread_t thread;
+     bool started;
+ } __dazzle_group_worker_t;
+
+ // A set of contexts, usually one per display, that are rendered in parallel.
+ // Every context stays on the same thread for the group's whole life.
+ typedef struct dazzle_group
+ {
+     dazzle_allocator_t alloc;
+     uint32_t count;
+     dazzle_context_t **contexts;
+     __dazzle_group_worker_t *workers; // count - 1 of them, the caller renders index 0
+
+     pthread_mutex_t lock;
+     pthread_cond_t start;
+     pthread_cond_t done;
+     uint64_t generation;
+     uint32_t remaining;
+     bool result;
+     bool quit;
+
+     dazzle_group_fn fn;
+     void *user;
+ } dazzle_group_t;
+
+ //======== Function Prototypes ========//
+
+ /*
+  * dazzle_group_create(alloc,contexts,count) -> dazzle_group_t*
+  * Starts count - 1 worker threads for the given contexts. The contexts must not
+  * be used outside dazzle_group_render afterwards until the group is destroyed.
+  */
+ dazzle_group_t *dazzle_group_create(dazzle_allocator_t alloc, dazzle_context_t **contexts, uint32_t count);
+
+ /*
+  * dazzle_group_render(group,fn,user) -> bool
+  * Calls fn once per context, all of them at the same time, and waits for every
+  * one to return. False if any call did.
+  */
+ bool dazzle_group_render(dazzle_group_t *group, dazzle_group_fn fn, void *user);
+
+ /*
+  * dazzle_group_destroy(group)
+  * Stops the worker threads, the contexts themselves are left alone
+  */
+ void dazzle_group_destroy(dazzle_group_t *group);
+
+ //======== Function Implementations ========//
+ #ifdef __DAZZLE_IMPL__
+
+ static void *__dazzle_group_worker(void *arg)
+ {
+     __dazzle_group_worker_t *worker = (__dazzle_group_worker_t *)arg;
+     dazzle_group_t *group = worker->group;
+     uint64_t seen = 0;
+
+     pthread_mutex_lock(&group->lock);
+     for (;;)
+     {
+         while (!group->quit && group->generation == seen)
+             pthread_cond_wait(&group->start, &group->lock);
+         if (group->quit)
+             break;
+         seen = group->generation;
+
+         dazzle_group_fn fn = group->fn;
+         void *user = group->user;
+         pthread_mutex_unlock(&group->lock);
+
+         bool ok = fn(group->contexts[worker->index], worker->index, user);
+
+         pthread_mutex_lock(&group->lock);
+         group->result &= ok;
+         if (--group->remaining == 0)
+             pthread_cond_signal(&group->done);
+     }
+     pthread_mutex_unlock(&group->lock);
+     return NULL;
+ }
+
+ dazzle_group_t *dazzle_group_create(dazzle_allocator_t alloc, dazzle_context_t **contexts, uint32_t count)
+ {
+     if (contexts == NULL || count == 0)
+         return NULL;
+
+     dazzle_group_t *group = alloc.malloc(sizeof(dazzle_group_t));
+     if (group == NULL)
+         return NULL;
+     memset(group, 0, sizeof(dazzle_group_t));
+     group->alloc = alloc;
+     group->count = count;
+     pthread_mutex_init(&group->lock, NULL);
+     pthread_cond_init(&group->start, NULL);
+     pthread_cond_init(&group->done, NULL);
+
+     group->contexts = alloc.malloc(count * sizeof(dazzle_context_t *));
+     group->workers = alloc.malloc(count * sizeof(__dazzle_group_worker_t));
+     if (group->contexts == NULL || group->workers == NULL)
+     {
+         dazzle_group_destroy(group);
+         return NULL;
+     }
+     memcpy(group->contexts, contexts, count * sizeof(dazzle_context_t *));
+     memset(group->workers, 0, count * sizeof(__dazzle_group_worker_t));
+
+     for (uint32_t i = 1; i < count; i++)
+     {
+         __dazzle_group_worker_t *worker = &group->workers[i];
+         worker->group = group;
+         worker->index = i;
+         if (pthread_create(&worker->thread, NULL, __dazzle_group_worker, worker) != 0)
+         {
+             dazzle_group_destroy(group);
+             return NULL;
+         }
+         worker->started = true;
+     }
+     return group;
+ }
+
+ bool dazzle_group_render(dazzle_group_t *group, dazzle_group_fn fn, void *user)
+ {
+     pthread_mutex_lock(&group->lock);
+     group->fn = fn;
+     group->user = user;
+     group->result = true;
+     group->remaining = group->count - 1;
+     group->generation++;
+     pthread_cond_broadcast(&group->start);
+     pthread_mutex_unlock(&group->lock);
+
+     bool ok = fn(group->contexts[0], 0, user);
+
+     pthread_mutex_lock(&group->lock);
+     while (group->remaining != 0)
+         pthread_cond_wait(&group->done, &group->lock);
+     ok &= group->result;
+     pthread_mutex_unlock(&group->lock);
+     return ok;
+ }
+
+ void dazzle_group_destroy(dazzle_group_t *group)
+ {
+     if (group == NULL)
+         return;
+
+     pthread_mutex_lock(&group->lock);
+     group->quit = true;
+     pthread_cond_broadcast(&group->start);
+     pthread_mutex_unlock(&group->lock);
+
+     if (group->workers != NULL)
+     {
+         for (uint32_t i = 1; i < group->count; i++)
+             if (group->workers[i].started)
+                 pthread_join(group->workers[i].thread, NULL);
+         group->alloc.free(group->workers);
+     }
+
+     pthread_mutex_destroy(&group->lock);
+     pthread_cond_destroy(&group->start);
+     pthread_cond_destroy(&group->done);
+     if (group->contexts != NULL)
+         group->alloc.free(group->contexts);
+     group->alloc.free(group);
+ }
+ #endif
+
+ #endif // __GROUP_INC_C__
@@ -0,0 +1,197 @@
+ #ifndef __IMAGE_INC_C__
+ #define __IMAGE_INC_C__
+
+ #include <stdatomic.h>
+
+ //======== Structure Definitions ========//
+
+ // The image converted to one device pixel format
+ typedef struct dazzle_image_variant
+ {
+     dazzle_framebuffer_t format; // only bpp, masks and shifts matter
+     uint32_t stride;
+     uint8_t *pixels;
+     struct dazzle_image_variant *next;
+ } dazzle_image_variant_t;
+
+ // Immutable, reference counted pixels that any number of contexts, on any
+ // threads, can blit. Each device format is converted once and then shared.
+ typedef struct
+ {
+     _Atomic uint32_t refs;
+     dazzle_allocator_t alloc;
+     uint32_t width;
+     uint32_t height;
+     uint32_t *pixels; // dazzle colors
+     _Atomic(dazzle_image_variant_t *) variants;
+ } dazzle_image_t;
+
+ //======== Function Prototypes ========//
+
+ /*
+  * dazzle_image_create(alloc,width,height,pixels) -> dazzle_image_t*
+  * Copies width*height dazzle colors into a new image holding one reference
+  */
+ dazzle_image_t *dazzle_image_create(dazzle_allocator_t alloc, uint32_t width, uint32_t height, const uint32_t *pixels);
+
+ /*
+  * dazzle_image_retain(image) -> dazzle_image_t*
+  * Takes another reference, returns image
+  */
+ dazzle_image_t *dazzle_image_retain(dazzle_image_t *image);
+
+ /*
+  * dazzle_image_release(image)
+  * Drops a reference, the last one frees the image and every converted copy
+  */
+ void dazzle_image_release(dazzle_image_t *image);
+
+ /*
+  * dazzle_image_pixels(ctx,image,stride) -> const void*
+  * The image in ctx's device format, converted on first use for that format.
+  * Safe to call from several threads at once. NULL if ctx isn't framebuffer based.
+  */
+ const void *dazzle_image_pixels(dazzle_context_t *ctx, dazzle_image_t *image, uint32_t *stride);
+
+ /*
+  * dazzle_create_image_blitable(ctx,x,y,image) -> dazzle_retained_element_t*
+  * A blitable that draws the shared converted pixels directly. It borrows them,
+  * so image has to stay alive as long as the element.
+  */
+ dazzle_retained_element_t *dazzle_create_image_blitable(dazzle_context_t *ctx, uint32_t x, uint32_t y, dazzle_image_t *image);
+
+ //======== Function Implementations ========//
+ #ifdef __DAZZLE_IMPL__
+
+ static inline bool __image_same_format(const dazzle_framebuffer_t *a, const dazzle_framebuffer_t *b)
+ {
+     return a->bpp == b->bpp &&
+            a->red_mask == b->red_mask && a->red_shift == b->red_shift &&
+            a->green_mask == b->green_mask && a->green_shift == b->green_shift &&
+            a->blue_mask == b->blue_mask && a->blue_shift == b->blue_shift &&
+            a->alpha_mask == b->alpha_mask && a->alpha_shift == b->alpha_shift;
+ }
+
+ dazzle_image_t *dazzle_image_create(dazzle_allocator_t alloc, uint32_t width, uint32_t height, const uint32_t *pixels)
+ {
+     if (width == 0 || height == 0 || pixels == NULL)
+         return NULL;
+
+     dazzle_image_t *image = alloc.malloc(sizeof(dazzle_image_t));
+     if (image == NULL)
+         return NULL;
+
+     size_t size = (size_t)width * height * sizeof(uint32_t);
+     image->pixels = alloc.malloc(size);
+     if (image->pixels == NULL)
+     {
+         alloc.free(image);
+         return NULL;
+     }
+     memcpy(image->pixels, pixels, size);
+
+     atomic_init(&image->refs, 1);
+     atomic_init(&image->variants, NULL);
+     image->alloc = alloc;
+     image->width = width;
+     image->height = height;
+     return image;
+ }
+
+ dazzle_image_t *dazzle_image_retain(dazzle_image_t *image)
+ {
+     atomic_fetch_add_explicit(&image->refs, 1, memory_order_relaxed);
+     return image;
+ }
+
+ void dazzle_image_release(dazzle_image_t *image)
+ {
+     if (image == NULL || atomic_fetch_sub_explicit(&image->refs, 1, memory_order_acq_rel) != 1)
+         return;
+
+     dazzle_image_variant_t *v = atomic_load_explicit(&image->variants, memory_order_acquire);
+     while (v != NULL)
+     {
+         dazzle_image_variant_t *next = v->next;
+         image->alloc.free(v->pixels);
+         image->alloc.free(v);
+         v = next;
+     }
+     image->alloc.free(image->pixels);
+     image->alloc.free(image);
+ }
+
+ static dazzle_image_variant_t *__image_find(dazzle_image_variant_t *v, const dazzle_framebuffer_t *fb)
+ {
+     for (; v != NULL; v = v->next)
+         if (__image_same_format(&v->format, fb))
+             return v;
+     return NULL;
+ }
+
+ const void *dazzle_image_pixels(dazzle_context_t *ctx, dazzle_image_t *image, uint32_t *stride)
+ {
+     if (ctx->renderer_data == NULL || image == NULL)
+         return NULL;
+     dazzle_framebuffer_t *fb = (dazzle_framebuffer_t *)ctx->renderer_data;
+
+     dazzle_image_variant_t *head = atomic_load_explicit(&image->variants, memory_order_acquire);
+     dazzle_image_variant_t *v = __image_find(head, fb);
+     if (v != NULL)
+     {
+         *stride = v->stride;
+         return v->pixels;
+     }
+
+     // Convert outside any lock. Racing threads may both do it, one of them wins the push.
+     uint32_t bypp = fb->bpp / 8;
+     dazzle_image_variant_t *mine = image->alloc.malloc(sizeof(dazzle_image_variant_t));
+     if (mine == NULL)
+         return NULL;
+     mine->format = *fb;
+     mine->stride = image->width * bypp;
+     mine->pixels = image->alloc.malloc((size_t)mine->stride * image->height);
+     if (mine->pixels == NULL)
+     {
+         image->alloc.free(mine);
+         return NULL;
+     }
+     DAZZLE_TRACE_SCOPE("image_convert");
+     __DAZZLE_STAT(ctx, blit_translations, 1);
+     for (size_t i = 0; i < (size_t)image->width * image->height; i++)
+         __fb_store_pixel(mine->pixels + i * bypp, bypp, __convert_color(fb, image->pixels[i]));
+
+     mine->next = head;
+     while (!atomic_compare_exchange_weak_explicit(&image->variants, &mine->next, mine, memory_order_acq_rel, memory_order_acquire))
+     {
+         v = __image_find(mine->next, fb);
+         if (v != NULL)
+         {
+             image->alloc.free(mine->pixels);
+             image->alloc.free(mine);
+             *stride = v->stride;
+             return v->pixels;
+         }
+     }
+
+     *stride = mine->stride;
+     return mine->pixels;
+ }
+
+ dazzle_retained_element_t *dazzle_create_image_blitable(dazzle_context_t *ctx, uint32_t x, uint32_t y, dazzle_image_t *image)
+ {
+     uint32_t stride;
+     const void *pixels = dazzle_image_pixels(ctx, image, &stride);
+     if (pixels == NULL)
+         return NULL;
+
+     dazzle_retained_element_t *e = dazzle_create_blitable(ctx, x, y, image->width, image->height, (void *)pixels);
+     if (e == NULL)
+         return NULL;
+     e->type_data.blit.translated = true;
+     e->type_data.blit.stride = stride;
+     return e;
+ }
+ #endif
+
+ #endif // __IMAGE_INC_C__
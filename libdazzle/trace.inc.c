@@ -0,0 +1,310 @@
+ #ifndef __TRACE_INC_C__
+ #define __TRACE_INC_C__
+
+ #include <stdatomic.h>
+ #include <time.h>
+
+ //======== Defines ========//
+
+ // Events kept per thread, oldest ones are overwritten. Must be a power of two.
+ #ifndef DAZZLE_TRACE_RING_SIZE
+ #define DAZZLE_TRACE_RING_SIZE 4096
+ #endif
+
+ //======== Structure Definitions ========//
+
+ typedef struct
+ {
+     // Relaxed atomics, so a dump racing the owner reads stale values rather than torn ones
+     _Atomic(const char *) name; // has to outlive the trace, string literals in practice
+     _Atomic uint64_t start_ns;
+     _Atomic uint64_t duration_ns;
+ } dazzle_trace_event_t;
+
+ // One per thread that recorded something. Only its owner writes, dumps read
+ // concurrently and drop whatever got overwritten while they were copying.
+ typedef struct dazzle_trace_ring
+ {
+     dazzle_trace_event_t events[DAZZLE_TRACE_RING_SIZE];
+     _Atomic uint64_t head; // events ever written
+     _Atomic uint64_t tail; // events before this were cleared
+     uint32_t tid;
+     struct dazzle_trace_ring *next;
+ } dazzle_trace_ring_t;
+
+ typedef struct
+ {
+     const char *name;
+     uint64_t start_ns;
+ } __dazzle_trace_scope_t;
+
+ /*
+  * Receives the exported JSON, returns false to abort the dump
+  */
+ typedef bool (*dazzle_trace_write_t)(void *user, const void *data, size_t len);
+
+ //======== Function Prototypes ========//
+
+ /*
+  * dazzle_trace_enable(alloc)
+  * Starts recording. Rings are allocated with alloc the first time a thread
+  * records and live until the process exits.
+  */
+ void dazzle_trace_enable(dazzle_allocator_t alloc);
+
+ /*
+  * dazzle_trace_disable()
+  * Stops recording, what was recorded stays available for dumping
+  */
+ void dazzle_trace_disable(void);
+
+ /*
+  * dazzle_trace_clear()
+  * Forgets every event recorded so far on all threads
+  */
+ void dazzle_trace_clear(void);
+
+ /*
+  * dazzle_trace_record(name,start_ns,duration_ns)
+  * Adds a complete event to the calling thread's ring, for spans the scope macro can't express
+  */
+ void dazzle_trace_record(const char *name, uint64_t start_ns, uint64_t duration_ns);
+
+ /*
+  * dazzle_trace_dump(write,user) -> bool
+  * Writes every thread's events as Chrome trace JSON, which Perfetto opens as well
+  */
+ bool dazzle_trace_dump(dazzle_trace_write_t write, void *user);
+
+ //======== Scopes ========//
+ // DAZZLE_TRACE_SCOPE("name") records the rest of the enclosing block.
+ // While tracing is off it costs one relaxed load and a branch; defining
+ // DAZZLE_NO_TRACE removes it entirely.
+
+ extern _Atomic bool __dazzle_trace_on;
+
+ static inline uint64_t __dazzle_now_ns(void)
+ {
+     struct timespec ts;
+     clock_gettime(CLOCK_MONOTONIC, &ts);
+     return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+ }
+
+ static inline __dazzle_trace_scope_t __dazzle_trace_begin(const char *name)
+ {
+     __dazzle_trace_scope_t scope = {NULL, 0};
+     if (__builtin_expect(atomic_load_explicit(&__dazzle_trace_on, memory_order_relaxed), 0))
+     {
+         scope.name = name;
+         scope.start_ns = __dazzle_now_ns();
+     }
+     return scope;
+ }
+
+ static inline void __dazzle_trace_end(__dazzle_trace_scope_t *scope)
+ {
+     if (__builtin_expect(scope->name != NULL, 0))
+         dazzle_trace_record(scope->name, scope->start_ns, __dazzle_now_ns() - scope->start_ns);
+ }
+
+ #define __DAZZLE_TRACE_CAT2(a, b) a##b
+ #define __DAZZLE_TRACE_CAT(a, b) __DAZZLE_TRACE_CAT2(a, b)
+
+ #ifndef DAZZLE_NO_TRACE
+ #define DAZZLE_TRACE_SCOPE(name) \
+     __dazzle_trace_scope_t __DAZZLE_TRACE_CAT(__trace_scope_, __LINE__) __attribute__((cleanup(__dazzle_trace_end))) = __dazzle_trace_begin(name)
+ #else
+ #define DAZZLE_TRACE_SCOPE(name) ((void)0)
+ #endif
+
+ //======== Function Implementations ========//
+ #ifdef __DAZZLE_IMPL__
+
+ _Atomic bool __dazzle_trace_on = false;
+
+ static dazzle_allocator_t __dazzle_trace_alloc;
+ static _Atomic(dazzle_trace_ring_t *) __dazzle_trace_rings = NULL;
+ static _Atomic uint32_t __dazzle_trace_next_tid = 1;
+ static _Thread_local dazzle_trace_ring_t *__dazzle_trace_ring = NULL;
+
+ void dazzle_trace_enable(dazzle_allocator_t alloc)
+ {
+     __dazzle_trace_alloc = alloc;
+     atomic_store_explicit(&__dazzle_trace_on, true, memory_order_release);
+ }
+
+ void dazzle_trace_disable(void)
+ {
+     atomic_store_explicit(&__dazzle_trace_on, false, memory_order_release);
+ }
+
+ void dazzle_trace_clear(void)
+ {
+     dazzle_trace_ring_t *ring = atomic_load_explicit(&__dazzle_trace_rings, memory_order_acquire);
+     for (; ring != NULL; ring = ring->next)
+         atomic_store_explicit(&ring->tail, atomic_load_explicit(&ring->head, memory_order_acquire), memory_order_release);
+ }
+
+ // The calling thread's ring, registered on first use with a lock-free push
+ static dazzle_trace_ring_t *__dazzle_trace_thread_ring(void)
+ {
+     if (__dazzle_trace_ring != NULL)
+         return __dazzle_trace_ring;
+     if (__dazzle_trace_alloc.malloc == NULL)
+         return NULL;
+
+     dazzle_trace_ring_t *ring = __dazzle_trace_alloc.malloc(sizeof(dazzle_trace_ring_t));
+     if (ring == NULL)
+         return NULL;
+     atomic_init(&ring->head, 0);
+     atomic_init(&ring->tail, 0);
+     ring->tid = atomic_fetch_add_explicit(&__dazzle_trace_next_tid, 1, memory_order_relaxed);
+
+     ring->next = atomic_load_explicit(&__dazzle_trace_rings, memory_order_relaxed);
+     while (!atomic_compare_exchange_weak_explicit(&__dazzle_trace_rings, &ring->next, ring, memory_order_release, memory_order_relaxed))
+         ;
+
+     __dazzle_trace_ring = ring;
+     return ring;
+ }
+
+ void dazzle_trace_record(const char *name, uint64_t start_ns, uint64_t duration_ns)
+ {
+     dazzle_trace_ring_t *ring = __dazzle_trace_thread_ring();
+     if (ring == NULL)
+         return;
+
+     uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+     dazzle_trace_event_t *ev = &ring->events[head & (DAZZLE_TRACE_RING_SIZE - 1)];
+     // A dump that sees any of the new fields also sees the head that claimed the slot
+     atomic_thread_fence(memory_order_release);
+     atomic_store_explicit(&ev->name, name, memory_order_relaxed);
+     atomic_store_explicit(&ev->start_ns, start_ns, memory_order_relaxed);
+     atomic_store_explicit(&ev->duration_ns, duration_ns, memory_order_relaxed);
+     atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+ }
+
+ //======== Chrome trace export ========//
+
+ typedef struct
+ {
+     char buf[512];
+     size_t len;
+     dazzle_trace_write_t write;
+     void *user;
+     bool failed;
+ } __dazzle_trace_out_t;
+
+ static void __dazzle_trace_flush(__dazzle_trace_out_t *out)
+ {
+     if (out->len != 0 && !out->failed && !out->write(out->user, out->buf, out->len))
+         out->failed = true;
+     out->len = 0;
+ }
+
+ static void __dazzle_trace_put(__dazzle_trace_out_t *out, const char *s, size_t n)
+ {
+     while (n != 0)
+     {
+         if (out->len == sizeof(out->buf))
+             __dazzle_trace_flush(out);
+         size_t chunk = sizeof(out->buf) - out->len;
+         if (chunk > n)
+             chunk = n;
+         memcpy(out->buf + out->len, s, chunk);
+         out->len += chunk;
+         s += chunk;
+         n -= chunk;
+     }
+ }
+
+ static void __dazzle_trace_puts(__dazzle_trace_out_t *out, const char *s)
+ {
+     __dazzle_trace_put(out, s, strlen(s));
+ }
+
+ static void __dazzle_trace_put_u64(__dazzle_trace_out_t *out, uint64_t v)
+ {
+     char digits[20];
+     size_t n = 0;
+     do
+     {
+         digits[sizeof(digits) - ++n] = '0' + v % 10;
+         v /= 10;
+     } while (v != 0);
+     __dazzle_trace_put(out, digits + sizeof(digits) - n, n);
+ }
+
+ // Chrome wants microseconds, keep the nanoseconds as three decimals
+ static void __dazzle_trace_put_us(__dazzle_trace_out_t *out, uint64_t ns)
+ {
+     char frac[4] = {'.', '0' + ns / 100 % 10, '0' + ns / 10 % 10, '0' + ns % 10};
+     __dazzle_trace_put_u64(out, ns / 1000);
+     __dazzle_trace_put(out, frac, sizeof(frac));
+ }
+
+ static void __dazzle_trace_put_name(__dazzle_trace_out_t *out, const char *name)
+ {
+     for (; *name != '\0'; name++)
+     {
+         if (*name == '"' || *name == '\\')
+             __dazzle_trace_put(out, "\\", 1);
+         if ((unsigned char)*name >= 0x20)
+             __dazzle_trace_put(out, name, 1);
+     }
+ }
+
+ bool dazzle_trace_dump(dazzle_trace_write_t write, void *user)
+ {
+     __dazzle_trace_out_t out;
+     out.len = 0;
+     out.write = write;
+     out.user = user;
+     out.failed = false;
+
+     bool first = true;
+     __dazzle_trace_puts(&out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+     dazzle_trace_ring_t *ring = atomic_load_explicit(&__dazzle_trace_rings, memory_order_acquire);
+     for (; ring != NULL && !out.failed; ring = ring->next)
+     {
+         uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+         uint64_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+         uint64_t begin = head > DAZZLE_TRACE_RING_SIZE ? head - DAZZLE_TRACE_RING_SIZE : 0;
+         if (begin < tail)
+             begin = tail;
+
+         for (uint64_t i = begin; i < head; i++)
+         {
+             dazzle_trace_event_t *slot = &ring->events[i & (DAZZLE_TRACE_RING_SIZE - 1)];
+             const char *name = atomic_load_explicit(&slot->name, memory_order_relaxed);
+             uint64_t start_ns = atomic_load_explicit(&slot->start_ns, memory_order_relaxed);
+             uint64_t duration_ns = atomic_load_explicit(&slot->duration_ns, memory_order_relaxed);
+
+             // The owner may have lapped us while we copied, skip what it overwrote.
+             // Event i + RING_SIZE is written while head is still i + RING_SIZE.
+             atomic_thread_fence(memory_order_acquire);
+             uint64_t now_head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+             if (i + DAZZLE_TRACE_RING_SIZE <= now_head)
+                 continue;
+
+             __dazzle_trace_puts(&out, first ? "\n{\"name\":\"" : ",\n{\"name\":\"");
+             __dazzle_trace_put_name(&out, name);
+             __dazzle_trace_puts(&out, "\",\"ph\":\"X\",\"pid\":1,\"tid\":");
+             __dazzle_trace_put_u64(&out, ring->tid);
+             __dazzle_trace_puts(&out, ",\"ts\":");
+             __dazzle_trace_put_us(&out, start_ns);
+             __dazzle_trace_puts(&out, ",\"dur\":");
+             __dazzle_trace_put_us(&out, duration_ns);
+             __dazzle_trace_puts(&out, "}");
+             first = false;
+         }
+     }
+
+     __dazzle_trace_puts(&out, "\n]}\n");
+     __dazzle_trace_flush(&out);
+     return !out.failed;
+ }
+ #endif
+
+ #endif // __TRACE_INC_C__
@@ -0,0 +1,329 @@
+#ifndef __DT_CACHE_H__
+#define __DT_CACHE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <dazzle.h>
+#include <dt_glyphs.h>
+
+//======== Defines ========//
+
+//Cells per atlas page, pages are only allocated once glyphs need them
+#define DT_CACHE_PAGE_CELLS 64
+#define DT_CACHE_NONE UINT32_MAX
+
+//======== Structure Definitions ========//
+
+typedef struct {
+    uint64_t font; //the font's id, shared by retained copies and never reused
+    uint32_t glyph; //glyph number, so codepoints sharing a glyph share its cell
+    uint32_t fg;
+    uint32_t bg;
+    uint32_t scale;
+} glyph_key_t;
+
+typedef struct {
+    glyph_key_t key;
+    uint32_t width;
+    uint32_t height;
+    uint32_t prev; //towards the most recently used
+    uint32_t next; //towards the least recently used
+} glyph_cell_t;
+
+//Rendered glyphs in one device format, packed into fixed-size cells of an atlas.
+//Pages stack their cells vertically, so every glyph row is one contiguous copy.
+//A cache belongs to one thread; share glyph_set_t between threads instead.
+typedef struct {
+    dazzle_allocator_t alloc;
+    dazzle_framebuffer_t format;
+    uint32_t bypp;
+
+    uint32_t cell_width;
+    uint32_t cell_height;
+    uint32_t stride;      //bytes per cell row
+    size_t cell_bytes;
+
+    uint32_t capacity;    //cells that fit in the memory cap
+    uint32_t used;        //cells handed out so far
+    glyph_cell_t* cells;
+    uint8_t** pages;
+
+    //Open addressing index from key to cell//
+    uint32_t* table;
+    uint32_t table_mask;
+
+    uint32_t lru_head;
+    uint32_t lru_tail;
+
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+} glyph_cache_t;
+
+//======== Helpers ========//
+
+static inline bool __dt_same_format(const dazzle_framebuffer_t* a, const dazzle_framebuffer_t* b){
+    return a->bpp == b->bpp &&
+           a->red_mask == b->red_mask && a->red_shift == b->red_shift &&
+           a->green_mask == b->green_mask && a->green_shift == b->green_shift &&
+           a->blue_mask == b->blue_mask && a->blue_shift == b->blue_shift &&
+           a->alpha_mask == b->alpha_mask && a->alpha_shift == b->alpha_shift;
+}
+
+static inline uint32_t __dt_key_hash(const glyph_key_t* k){
+    uint64_t h = k->font * 0x9E3779B97F4A7C15ull;
+    h ^= ((uint64_t)k->glyph << 32 | k->scale) * 0xC2B2AE3D27D4EB4Full;
+    h ^= ((uint64_t)k->fg << 32 | k->bg) * 0x165667B19E3779F9ull;
+    h ^= h >> 29;
+    h *= 0xBF58476D1CE4E5B9ull;
+    return (uint32_t)(h ^ (h >> 32));
+}
+
+static inline bool __dt_key_equal(const glyph_key_t* a, const glyph_key_t* b){
+    return a->font == b->font && a->glyph == b->glyph && a->fg == b->fg && a->bg == b->bg && a->scale == b->scale;
+}
+
+static inline uint8_t* __dt_cell_pixels(glyph_cache_t* cache, uint32_t cell){
+    return cache->pages[cell / DT_CACHE_PAGE_CELLS] + (size_t)(cell % DT_CACHE_PAGE_CELLS) * cache->cell_bytes;
+}
+
+static void __dt_lru_unlink(glyph_cache_t* cache, uint32_t i){
+    glyph_cell_t* c = &cache->cells[i];
+    if(c->prev != DT_CACHE_NONE) cache->cells[c->prev].next = c->next; else cache->lru_head = c->next;
+    if(c->next != DT_CACHE_NONE) cache->cells[c->next].prev = c->prev; else cache->lru_tail = c->prev;
+}
+
+static void __dt_lru_push_front(glyph_cache_t* cache, uint32_t i){
+    glyph_cell_t* c = &cache->cells[i];
+    c->prev = DT_CACHE_NONE;
+    c->next = cache->lru_head;
+    if(cache->lru_head != DT_CACHE_NONE) cache->cells[cache->lru_head].prev = i;
+    cache->lru_head = i;
+    if(cache->lru_tail == DT_CACHE_NONE) cache->lru_tail = i;
+}
+
+//Removes a cell from the index, shifting later entries of its probe run back
+static void __dt_table_remove(glyph_cache_t* cache, uint32_t cell){
+    uint32_t i = __dt_key_hash(&cache->cells[cell].key) & cache->table_mask;
+    while(cache->table[i] != cell) i = (i + 1) & cache->table_mask;
+
+    uint32_t hole = i;
+    for(;;){
+        i = (i + 1) & cache->table_mask;
+        uint32_t moved = cache->table[i];
+        if(moved == DT_CACHE_NONE) break;
+        uint32_t home = __dt_key_hash(&cache->cells[moved].key) & cache->table_mask;
+        //Move it unless its home lies cyclically in (hole, i]
+        if(((i - home) & cache->table_mask) >= ((i - hole) & cache->table_mask)){
+            cache->table[hole] = moved;
+            hole = i;
+        }
+    }
+    cache->table[hole] = DT_CACHE_NONE;
+}
+
+//Expands a PSF glyph straight into device pixels, scale x scale per source pixel
+static void __dt_cache_render(glyph_cache_t* cache, font_t* font, uint32_t glyph, uint32_t scale, uint64_t fg, uint64_t bg, uint8_t* dst){
+    uint32_t bypp = cache->bypp;
+    uint32_t width_bytes = (font->suggested_width + 7) / 8;
+    const uint8_t* bits = (const uint8_t*)font->glyph_data + (size_t)glyph * font->psfx_bytes_per_glyph;
+
+    for(uint32_t i = 0; i < font->suggested_height; i++, bits += width_bytes){
+        uint8_t* row = dst + (size_t)i * scale * cache->stride;
+        uint8_t* out = row;
+        for(uint32_t j = 0; j < font->suggested_width; j++){
+            uint64_t px = (bits[j / 8] >> (7 - j % 8)) & 1 ? fg : bg;
+            for(uint32_t s = 0; s < scale; s++, out += bypp)
+                memcpy(out, &px, bypp);
+        }
+        for(uint32_t s = 1; s < scale; s++)
+            memcpy(row + (size_t)s * cache->stride, row, (size_t)font->suggested_width * scale * bypp);
+    }
+}
+
+//======== Functions ========//
+
+/*
+ * @brief Creates a glyph cache for the pixel format of a context
+ *
+ * @param ctx A framebuffer based context whose format the atlas uses
+ * @param cell_width The widest glyph the cache holds, in pixels after scaling
+ * @param cell_height The tallest glyph the cache holds, in pixels after scaling
+ * @param max_bytes Memory cap for the atlas pages, at least one cell is always kept
+ * @return glyph_cache_t* The cache, or NULL on failure
+*/
+glyph_cache_t* create_glyph_cache(dazzle_context_t* ctx, uint32_t cell_width, uint32_t cell_height, size_t max_bytes){
+    if(ctx->renderer_data == NULL || cell_width == 0 || cell_height == 0) return NULL;
+    dazzle_framebuffer_t* fb = (dazzle_framebuffer_t*)ctx->renderer_data;
+
+    glyph_cache_t* cache = ctx->alloc.malloc(sizeof(glyph_cache_t));
+    if(cache == NULL) return NULL;
+    memset(cache, 0, sizeof(glyph_cache_t));
+
+    cache->alloc = ctx->alloc;
+    cache->format = *fb;
+    cache->bypp = fb->bpp / 8;
+    cache->cell_width = cell_width;
+    cache->cell_height = cell_height;
+    cache->stride = cell_width * cache->bypp;
+    cache->cell_bytes = (size_t)cache->stride * cell_height;
+
+    size_t capacity = max_bytes / cache->cell_bytes;
+    cache->capacity = capacity == 0 ? 1 : capacity > (1u << 24) ? (1u << 24) : (uint32_t)capacity;
+
+    uint32_t table_size = 16;
+    while(table_size < cache->capacity * 2) table_size *= 2;
+    cache->table_mask = table_size - 1;
+
+    uint32_t page_count = (cache->capacity + DT_CACHE_PAGE_CELLS - 1) / DT_CACHE_PAGE_CELLS;
+    cache->cells = cache->alloc.malloc(cache->capacity * sizeof(glyph_cell_t));
+    cache->pages = cache->alloc.malloc(page_count * sizeof(uint8_t*));
+    cache->table = cache->alloc.malloc(table_size * sizeof(uint32_t));
+    if(cache->cells == NULL || cache->pages == NULL || cache->table == NULL){
+        if(cache->cells) cache->alloc.free(cache->cells);
+        if(cache->pages) cache->alloc.free(cache->pages);
+        if(cache->table) cache->alloc.free(cache->table);
+        cache->alloc.free(cache);
+        return NULL;
+    }
+    memset(cache->pages, 0, page_count * sizeof(uint8_t*));
+    memset(cache->table, 0xFF, table_size * sizeof(uint32_t));
+    cache->lru_head = DT_CACHE_NONE;
+    cache->lru_tail = DT_CACHE_NONE;
+
+    return cache;
+}
+
+/*
+ * @brief Looks a glyph up, rendering it into the atlas on a miss
+ *
+ * @param cache The cache to use
+ * @param ctx The context the pixels are for, it must have the cache's format
+ * @param font The font to render from
+ * @param c The codepoint
+ * @param scale Integer scale factor, 1 for the font's own size
+ * @param fg The foreground color as a dazzle color
+ * @param bg The background color as a dazzle color, written into the pixels even with zero alpha
+ * @param stride Set to the bytes per row of the returned pixels
+ * @param width Set to the glyph width
+ * @param height Set to the glyph height
+ * @return const void* Device pixels, valid until the next lookup, or NULL
+*/
+const void* glyph_cache_lookup(glyph_cache_t* cache, dazzle_context_t* ctx, font_t* font, uint32_t c, uint32_t scale, uint32_t fg, uint32_t bg,
+                               uint32_t* stride, uint32_t* width, uint32_t* height){
+    if(ctx->renderer_data == NULL || !__dt_same_format(&cache->format, (dazzle_framebuffer_t*)ctx->renderer_data)) return NULL;
+    if(font->format != BT_FORMAT_PSF1 && font->format != BT_FORMAT_PSF2) return NULL;
+    if(scale == 0) scale = 1;
+
+    //Key on what gets drawn, a new replacement glyph must not hit the old one
+    uint32_t glyph = font_glyph_index(font, c);
+    if(glyph >= font->glyph_count) return NULL;
+    glyph_key_t key = {font->id, glyph, fg, bg, scale};
+    uint32_t slot = __dt_key_hash(&key) & cache->table_mask;
+    for(; cache->table[slot] != DT_CACHE_NONE; slot = (slot + 1) & cache->table_mask){
+        uint32_t i = cache->table[slot];
+        if(__dt_key_equal(&cache->cells[i].key, &key)){
+            cache->hits++;
+            if(cache->lru_head != i){
+                __dt_lru_unlink(cache, i);
+                __dt_lru_push_front(cache, i);
+            }
+            *stride = cache->stride;
+            *width = cache->cells[i].width;
+            *height = cache->cells[i].height;
+            return __dt_cell_pixels(cache, i);
+        }
+    }
+
+    uint32_t w = font->suggested_width * scale, h = font->suggested_height * scale;
+    if(w > cache->cell_width || h > cache->cell_height) return NULL;
+    cache->misses++;
+
+    //A free cell, a new page of them, or the least recently used one//
+    uint32_t cell;
+    if(cache->used < cache->capacity){
+        cell = cache->used;
+        uint8_t** page = &cache->pages[cell / DT_CACHE_PAGE_CELLS];
+        if(*page == NULL){
+            uint32_t cells = cache->capacity - cell < DT_CACHE_PAGE_CELLS ? cache->capacity - cell : DT_CACHE_PAGE_CELLS;
+            *page = cache->alloc.malloc(cells * cache->cell_bytes);
+            if(*page == NULL) return NULL;
+        }
+        cache->used++;
+    } else {
+        cell = cache->lru_tail;
+        __dt_table_remove(cache, cell);
+        __dt_lru_unlink(cache, cell);
+        cache->evictions++;
+        //The slot found above may have moved, probe again for the insert
+        slot = __dt_key_hash(&key) & cache->table_mask;
+        while(cache->table[slot] != DT_CACHE_NONE) slot = (slot + 1) & cache->table_mask;
+    }
+
+    glyph_cell_t* entry = &cache->cells[cell];
+    entry->key = key;
+    entry->width = w;
+    entry->height = h;
+    cache->table[slot] = cell;
+    __dt_lru_push_front(cache, cell);
+
+    __dt_cache_render(cache, font, glyph, scale, dazzle_map_color(ctx, fg), dazzle_map_color(ctx, bg), __dt_cell_pixels(cache, cell));
+
+    *stride = cache->stride;
+    *width = w;
+    *height = h;
+    return __dt_cell_pixels(cache, cell);
+}
+
+/*
+ * @brief Draws a glyph through the cache, a hit is one lookup and one copy per row
+ *
+ * @param cache The cache to use, made for ctx's pixel format
+ * @param ctx The context to draw into
+ * @param font The font to use
+ * @param c The codepoint
+ * @param x The left edge
+ * @param y The top edge
+ * @param scale Integer scale factor
+ * @param fg The foreground color
+ * @param bg The background color, zero alpha leaves the background alone like draw_glyph
+ * @return bool False if the glyph could not be drawn
+*/
+bool glyph_cache_draw(glyph_cache_t* cache, dazzle_context_t* ctx, font_t* font, uint32_t c, uint32_t x, uint32_t y, uint32_t scale, uint32_t fg, uint32_t bg){
+    //The atlas holds opaque cells, a see-through background needs the uncached path
+    if(bg >> 24 == 0) return draw_glyph_scaled(ctx, *font, c, x, y, scale, fg, bg);
+    uint32_t stride, width, height;
+    const void* pixels = glyph_cache_lookup(cache, ctx, font, c, scale, fg, bg, &stride, &width, &height);
+    if(pixels == NULL) return false;
+    return dazzle_blit(ctx, x, y, width, height, pixels, stride);
+}
+
+/*
+ * @brief Forgets every cached glyph, keeping the memory for reuse
+ *
+ * @param cache The cache to clear
+*/
+void glyph_cache_clear(glyph_cache_t* cache){
+    memset(cache->table, 0xFF, (size_t)(cache->table_mask + 1) * sizeof(uint32_t));
+    cache->used = 0;
+    cache->lru_head = DT_CACHE_NONE;
+    cache->lru_tail = DT_CACHE_NONE;
+}
+
+/*
+ * @brief Frees a glyph cache and its atlas
+ *
+ * @param cache The cache to free
+*/
+void glyph_cache_destroy(glyph_cache_t* cache){
+    if(cache == NULL) return;
+    uint32_t page_count = (cache->capacity + DT_CACHE_PAGE_CELLS - 1) / DT_CACHE_PAGE_CELLS;
+    for(uint32_t i = 0; i < page_count; i++)
+        if(cache->pages[i] != NULL) cache->alloc.free(cache->pages[i]);
+    cache->alloc.free(cache->pages);
+    cache->alloc.free(cache->cells);
+    cache->alloc.free(cache->table);
+    cache->alloc.free(cache);
+}
+
+#endif // __DT_CACHE_H__
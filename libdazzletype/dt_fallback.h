@@ -0,0 +1,161 @@
+#ifndef __DT_FALLBACK_H__
+#define __DT_FALLBACK_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include <dazzle.h>
+#include "dt_glyphs.h"
+
+//======== Defines ========//
+
+#define DT_MAX_FALLBACK 8
+#define DT_CHAIN_NONE 0xFFFFFFFF
+
+//Unicode ends at 0x10FFFF, so this many pages of 256 cover all of it
+#define __DT_CHAIN_PAGES 0x1100
+
+//======== Structure Definitions ========//
+
+//Fonts tried in order for every codepoint, like a Latin PSF backed by a CJK TrueType.
+//Which font covers what is merged into one index when the chain is built, so
+//resolving a character is two loads no matter how many fonts there are.
+typedef struct {
+    dazzle_allocator_t alloc;
+    uint32_t count;
+    font_t fonts[DT_MAX_FALLBACK]; //the chain holds a reference to each
+
+    //Same two levels as a font's unicode map: pages[c >> 8] picks a page of
+    //256 entries, each font number << 24 | glyph. Page 0 is all DT_CHAIN_NONE.
+    uint16_t* pages;
+    uint32_t* entries;
+    uint32_t page_count;
+} font_chain_t;
+
+//======== Coverage ========//
+
+//Marks the pages of the codepoint space a font has any glyph in
+static void __dt_chain_mark(const font_t* font, uint8_t* used_pages, uint32_t* max_page){
+    uint32_t last;
+    if(font->uc_pages == NULL){
+        if(font->glyph_count == 0) return;
+        last = (font->glyph_count - 1) >> 8;
+        if(last >= __DT_CHAIN_PAGES) last = __DT_CHAIN_PAGES - 1;
+        for(uint32_t p = 0; p <= last; p++) used_pages[p / 8] |= 1 << p % 8;
+    } else {
+        last = 0;
+        for(uint32_t p = 0; p < font->uc_page_count && p < __DT_CHAIN_PAGES; p++){
+            if(font->uc_pages[p] == 0) continue;
+            used_pages[p / 8] |= 1 << p % 8;
+            last = p;
+        }
+    }
+    if(last > *max_page) *max_page = last;
+}
+
+//======== Functions ========//
+
+/*
+ * @brief Builds a fallback chain, the first font that has a character draws it
+ *
+ * The fonts' coverage is merged here, once, so lookups never probe the fonts
+ * one by one. Codepoints no font has get the first font's replacement glyph.
+ *
+ * @param alloc The allocator to use
+ * @param fonts The fonts in order of preference, the chain keeps a reference to each
+ * @param count 1 to DT_MAX_FALLBACK
+ * @return font_chain_t* The chain, or NULL on failure
+*/
+font_chain_t* create_font_chain(dazzle_allocator_t alloc, const font_t* fonts, uint32_t count){
+    if(count == 0 || count > DT_MAX_FALLBACK) return NULL;
+    for(uint32_t i = 0; i < count; i++)
+        if(fonts[i].format == BT_INVALID_FORMAT) return NULL;
+
+    uint8_t used_pages[__DT_CHAIN_PAGES / 8] = {0};
+    uint32_t max_page = 0, page_count = 1;
+    for(uint32_t i = 0; i < count; i++) __dt_chain_mark(&fonts[i], used_pages, &max_page);
+    for(uint32_t p = 0; p <= max_page; p++)
+        if(used_pages[p / 8] & (1 << p % 8)) page_count++;
+
+    size_t pages_size = ((max_page + 1) * sizeof(uint16_t) + 3) & ~(size_t)3;
+    font_chain_t* chain = alloc.malloc(sizeof(font_chain_t) + pages_size + (size_t)page_count * 256 * sizeof(uint32_t));
+    if(chain == NULL) return NULL;
+    memset(chain, 0, sizeof(font_chain_t));
+    chain->alloc = alloc;
+    chain->page_count = max_page + 1;
+    chain->pages = (uint16_t*)(chain + 1);
+    chain->entries = (uint32_t*)((uint8_t*)chain->pages + pages_size);
+    memset(chain->pages, 0, (max_page + 1) * sizeof(uint16_t));
+    memset(chain->entries, 0xFF, 256 * sizeof(uint32_t));
+
+    //First font to have a codepoint wins it
+    uint16_t next_page = 1;
+    for(uint32_t p = 0; p <= max_page; p++){
+        if(!(used_pages[p / 8] & (1 << p % 8))) continue;
+        chain->pages[p] = next_page;
+        uint32_t* entry = chain->entries + ((uint32_t)next_page++ << 8);
+        for(uint32_t k = 0; k < 256; k++){
+            uint32_t glyph;
+            entry[k] = DT_CHAIN_NONE;
+            for(uint32_t i = 0; i < count; i++){
+                if(!font_lookup(&fonts[i], p << 8 | k, &glyph)) continue;
+                entry[k] = i << 24 | glyph;
+                break;
+            }
+        }
+    }
+
+    for(uint32_t i = 0; i < count; i++) chain->fonts[i] = font_retain(fonts[i]);
+    chain->count = count;
+    return chain;
+}
+
+/*
+ * @brief Resolves a codepoint to the font and glyph that draw it
+ *
+ * @param chain The chain
+ * @param c The codepoint
+ * @param font Set to the font's position in the chain
+ * @return uint32_t A glyph index that is always in bounds for that font
+*/
+static inline uint32_t font_chain_glyph(const font_chain_t* chain, uint32_t c, uint32_t* font){
+    uint32_t e = DT_CHAIN_NONE;
+    if((c >> 8) < chain->page_count) e = chain->entries[(uint32_t)chain->pages[c >> 8] << 8 | (c & 0xFF)];
+    if(e == DT_CHAIN_NONE){
+        *font = 0;
+        return chain->fonts[0].replacement;
+    }
+    *font = e >> 24;
+    return e & 0xFFFFFF;
+}
+
+/*
+ * @brief Draws a character with whichever font of the chain has it
+ *
+ * @param ctx The context to draw into
+ * @param chain The chain
+ * @param c The codepoint
+ * @param x The left edge
+ * @param y The top edge
+ * @param fg The color of the glyph
+ * @param bg The color behind it, zero alpha leaves the background alone
+ * @return bool False if the glyph could not be drawn
+*/
+bool font_chain_draw_glyph(dazzle_context_t* ctx, const font_chain_t* chain, uint32_t c, uint32_t x, uint32_t y, uint32_t fg, uint32_t bg){
+    uint32_t font, glyph = font_chain_glyph(chain, c, &font);
+    return draw_glyph_index(ctx, chain->fonts[font], glyph, x, y, 1, fg, bg);
+}
+
+/*
+ * @brief Frees a chain and drops its font references
+ *
+ * @param chain The chain
+*/
+void font_chain_destroy(font_chain_t* chain){
+    if(chain == NULL) return;
+    for(uint32_t i = 0; i < chain->count; i++) font_release(&chain->fonts[i]);
+    chain->alloc.free(chain);
+}
+
+#endif // __DT_FALLBACK_H__
@@ -4,7 +4,13 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdatomic.h>
 #include <dazzle.h>
+#include "dt_ttf.h"
 
 #ifndef PACKED
     #define PACKED __attribute__((packed))
@@ -17,7 +23,9 @@
 
 #define PSF1_MODE_512 0x01
 #define PSF1_MODE_HASTABLE 0x02
-#define PSF1_MODE_SEQ 0x03
+#define PSF1_MODE_SEQ 0x04
+#define PSF1_SEPARATOR 0xFFFF
+#define PSF1_START_SEQ 0xFFFE
 
 typedef struct {
     uint16_t magic;
@@ -29,6 +37,8 @@ typedef struct {
 #define PSF2_MAGIC 0x864ab572
 
 #define PSF2_FLAG_UC 0x01
+#define PSF2_SEPARATOR 0xFF
+#define PSF2_START_SEQ 0xFE
 
 typedef struct {
     uint32_t magic;
@@ -49,8 +59,27 @@ typedef enum {
     BT_FORMAT_TTF
 } bt_format_t;
 
+//======== Defines ========//
+
+#define DT_NO_GLYPH 0xFFFF
+#define DT_MAX_SEQUENCE 16
+#define DT_REPLACEMENT_CHARACTER 0xFFFD
+#define DT_TTF_DEFAULT_SIZE 16
+#define DT_MAX_SCALE 4
+
+//Table markers once read, outside the codepoint range so no character can look like one
+#define __DT_UC_SEPARATOR 0xFFFFFFFF
+#define __DT_UC_START_SEQ 0xFFFFFFFE
+
 //======== Structure Definitions ========//
 
+//A run of codepoints drawn with one glyph, like a letter and its combining accent
+typedef struct {
+    uint32_t glyph;
+    uint32_t start; //into uc_sequence_cps
+    uint32_t length;
+} font_sequence_t;
+
 typedef struct {
     dazzle_allocator_t alloc;
     bt_format_t format;
@@ -61,9 +90,31 @@ typedef struct {
     uint32_t suggested_height;
 
     char* glyph_data;
+    _Atomic uint32_t* refs; //shared by every copy of this font, see font_retain
+    uint64_t id; //unique per load and never reused, caches key on it instead of addresses
+
+    //Unicode map, two levels: uc_pages[c >> 8] picks a page of 256 glyph
+    //indices in uc_glyphs. Page 0 is all DT_NO_GLYPH, so unmapped pages cost
+    //nothing. NULL when the font has no table and codepoints are glyph indices.
+    uint16_t* uc_pages;
+    uint16_t* uc_glyphs;
+    uint32_t uc_page_count;
+    font_sequence_t* uc_sequences; //sorted by first codepoint
+    uint32_t* uc_sequence_cps;
+    uint32_t uc_sequence_count;
+    uint32_t replacement; //glyph drawn for codepoints the font lacks
+
+    //The file glyph_data points into when loaded with load_font_mapped, read only
+    void* mapping;
+    size_t mapping_size;
 
     //PSFX stuff
     uint32_t psfx_bytes_per_glyph;
+
+    //TTF stuff, glyph_data is the whole file. The suggested cell fits a line at ttf_size pixels per em.
+    ttf_font_t* ttf;
+    uint32_t ttf_size;
+    uint32_t ttf_ascent;
 } font_t;
 
 typedef struct {
@@ -72,65 +123,558 @@ typedef struct {
     uint32_t height;
 } glyph_t; 
 
+//Every glyph of a font pre-rendered in one color, shareable between contexts and threads.
+//glyphs is indexed by glyph number, map codepoints with font_glyph_index first.
+typedef struct {
+    _Atomic uint32_t refs;
+    font_t font;
+    uint32_t color;
+    uint32_t count;
+    dazzle_image_t** glyphs;
+} glyph_set_t;
+
+//======== Unicode Tables ========//
+
+typedef struct {
+    const uint8_t* p;
+    const uint8_t* end;
+    bool psf1;
+    uint32_t glyph;
+    uint32_t glyph_count;
+} __dt_uc_iter_t;
+
+//One value of the table, a UTF-8 character or a separator byte for PSF2, a little endian word for PSF1
+static bool __dt_uc_read(__dt_uc_iter_t* it, uint32_t* v, bool peek){
+    const uint8_t* p = it->p;
+    if(it->psf1){
+        if(it->end - p < 2) return false;
+        *v = p[0] | (uint32_t)p[1] << 8;
+        p += 2;
+        if(*v == PSF1_SEPARATOR) *v = __DT_UC_SEPARATOR;
+        else if(*v == PSF1_START_SEQ) *v = __DT_UC_START_SEQ;
+    } else {
+        if(p >= it->end) return false;
+        uint32_t b = *p++;
+        if(b >= 0xFE || b < 0x80){
+            *v = b == PSF2_SEPARATOR ? __DT_UC_SEPARATOR : b == PSF2_START_SEQ ? __DT_UC_START_SEQ : b;
+        } else {
+            uint32_t extra = b >= 0xF0 ? 3 : b >= 0xE0 ? 2 : b >= 0xC0 ? 1 : 0;
+            *v = b & (0x3F >> extra);
+            if(extra == 0 || it->end - p < extra) *v = DT_REPLACEMENT_CHARACTER, extra = 0;
+            for(uint32_t i = 0; i < extra; i++) *v = *v << 6 | (*p++ & 0x3F);
+            if(*v > 0x10FFFF) *v = DT_REPLACEMENT_CHARACTER;
+        }
+    }
+    if(!peek) it->p = p;
+    return true;
+}
+
+//Next mapping of the table: a single codepoint (length 1) or a sequence, false at the end
+static bool __dt_uc_next(__dt_uc_iter_t* it, uint32_t* cps, uint32_t* length, uint32_t* glyph){
+    uint32_t v;
+    while(it->glyph < it->glyph_count && __dt_uc_read(it, &v, false)){
+        if(v == __DT_UC_SEPARATOR){
+            it->glyph++;
+            continue;
+        }
+        *glyph = it->glyph;
+        *length = 0;
+        if(v != __DT_UC_START_SEQ){
+            cps[(*length)++] = v;
+            return true;
+        }
+        while(__dt_uc_read(it, &v, true) && v != __DT_UC_SEPARATOR && v != __DT_UC_START_SEQ){
+            __dt_uc_read(it, &v, false);
+            if(*length < DT_MAX_SEQUENCE) cps[(*length)++] = v;
+        }
+        if(*length != 0) return true;
+    }
+    return false;
+}
+
+//Bytes of the page directory and glyph pages, padded for what follows them
+static size_t __dt_uc_pages_size(uint32_t page_count, uint32_t max_page){
+    size_t size = (max_page + 1) * sizeof(uint16_t) + (size_t)(page_count + 1) * 256 * sizeof(uint16_t);
+    return (size + 3) & ~(size_t)3;
+}
+
+//Bytes the table needs after the glyphs, 0 when there is none to parse
+static size_t __dt_uc_measure(__dt_uc_iter_t it, uint8_t* used_pages, uint32_t* page_count, uint32_t* max_page, uint32_t* sequences, uint32_t* sequence_cps){
+    uint32_t cps[DT_MAX_SEQUENCE], length, glyph;
+    *page_count = *max_page = *sequences = *sequence_cps = 0;
+    memset(used_pages, 0, 0x1100 / 8);
+
+    bool any = false;
+    while(__dt_uc_next(&it, cps, &length, &glyph)){
+        any = true;
+        if(length > 1){
+            (*sequences)++;
+            *sequence_cps += length;
+            continue;
+        }
+        uint32_t page = cps[0] >> 8;
+        if(page >= 0x1100 || glyph >= DT_NO_GLYPH || used_pages[page / 8] & (1 << page % 8)) continue;
+        used_pages[page / 8] |= 1 << page % 8;
+        (*page_count)++;
+        if(page > *max_page) *max_page = page;
+    }
+    if(!any) return 0;
+
+    return __dt_uc_pages_size(*page_count, *max_page) + *sequences * sizeof(font_sequence_t) + *sequence_cps * sizeof(uint32_t);
+}
+
+//Lays out the page directory and empty glyph pages at space, returns the bytes used
+static size_t __dt_uc_pages(font_t* font, uint8_t* space, const uint8_t* used_pages, uint32_t page_count, uint32_t max_page){
+    font->uc_page_count = max_page + 1;
+    font->uc_pages = (uint16_t*)space;
+    font->uc_glyphs = font->uc_pages + font->uc_page_count;
+    memset(font->uc_pages, 0, font->uc_page_count * sizeof(uint16_t));
+    memset(font->uc_glyphs, 0xFF, (size_t)(page_count + 1) * 256 * sizeof(uint16_t));
+
+    uint16_t next_page = 1;
+    for(uint32_t page = 0; page <= max_page; page++)
+        if(used_pages[page / 8] & (1 << page % 8)) font->uc_pages[page] = next_page++;
+    return __dt_uc_pages_size(page_count, max_page);
+}
+
+//Fills the table into space sized by __dt_uc_measure
+static void __dt_uc_fill(font_t* font, __dt_uc_iter_t it, uint8_t* space, const uint8_t* used_pages, uint32_t page_count, uint32_t max_page, uint32_t sequences){
+    size_t offset = __dt_uc_pages(font, space, used_pages, page_count, max_page);
+    font->uc_sequences = (font_sequence_t*)(space + offset);
+    font->uc_sequence_cps = (uint32_t*)(font->uc_sequences + sequences);
+    font->uc_sequence_count = 0;
+
+    uint32_t cps[DT_MAX_SEQUENCE], length, glyph, cp_count = 0;
+    while(__dt_uc_next(&it, cps, &length, &glyph)){
+        if(length > 1){
+            font_sequence_t* seq = &font->uc_sequences[font->uc_sequence_count++];
+            seq->glyph = glyph;
+            seq->start = cp_count;
+            seq->length = length;
+            memcpy(font->uc_sequence_cps + cp_count, cps, length * sizeof(uint32_t));
+            cp_count += length;
+            continue;
+        }
+        if(cps[0] >= 0x110000 || glyph >= DT_NO_GLYPH) continue;
+        uint16_t* slot = &font->uc_glyphs[(uint32_t)font->uc_pages[cps[0] >> 8] << 8 | (cps[0] & 0xFF)];
+        if(*slot == DT_NO_GLYPH) *slot = glyph; //the first glyph listed for a codepoint wins
+    }
+
+    //Insertion sort by first codepoint, tables list few sequences and mostly in order already
+    for(uint32_t i = 1; i < font->uc_sequence_count; i++){
+        font_sequence_t seq = font->uc_sequences[i];
+        uint32_t first = font->uc_sequence_cps[seq.start], j = i;
+        for(; j > 0 && font->uc_sequence_cps[font->uc_sequences[j - 1].start] > first; j--)
+            font->uc_sequences[j] = font->uc_sequences[j - 1];
+        font->uc_sequences[j] = seq;
+    }
+}
+
+/*
+ * @brief Looks a codepoint up in the font's unicode map
+ * 
+ * @param font The font to use
+ * @param c The codepoint
+ * @param glyph Set to the glyph index when found
+ * @return bool False if the font has no glyph for c
+*/
+static inline bool font_lookup(const font_t* font, uint32_t c, uint32_t* glyph){
+    if(font->uc_pages == NULL){
+        *glyph = c;
+        return c < font->glyph_count;
+    }
+    if((c >> 8) >= font->uc_page_count) return false;
+    uint16_t g = font->uc_glyphs[(uint32_t)font->uc_pages[c >> 8] << 8 | (c & 0xFF)];
+    *glyph = g;
+    return g != DT_NO_GLYPH;
+}
+
+/*
+ * @brief Maps a codepoint to a glyph, falling back to the replacement glyph
+ * 
+ * @param font The font to use
+ * @param c The codepoint
+ * @return uint32_t A glyph index that is always in bounds
+*/
+static inline uint32_t font_glyph_index(const font_t* font, uint32_t c){
+    uint32_t glyph;
+    return font_lookup(font, c, &glyph) ? glyph : font->replacement;
+}
+
 /*
- * @brief Loads a font
+ * @brief Maps the longest codepoint sequence the font has a glyph for
+ * 
+ * @param font The font to use
+ * @param cps The codepoints, at least one
+ * @param count How many there are
+ * @param consumed Set to how many codepoints the glyph covers
+ * @return uint32_t A glyph index that is always in bounds
+*/
+uint32_t font_glyph_index_seq(const font_t* font, const uint32_t* cps, uint32_t count, uint32_t* consumed){
+    *consumed = 1;
+    uint32_t best = font_glyph_index(font, cps[0]);
+    if(font->uc_sequence_count == 0 || count < 2) return best;
+
+    //First sequence starting with cps[0], then every one after it that does
+    uint32_t lo = 0, hi = font->uc_sequence_count;
+    while(lo < hi){
+        uint32_t mid = (lo + hi) / 2;
+        if(font->uc_sequence_cps[font->uc_sequences[mid].start] < cps[0]) lo = mid + 1; else hi = mid;
+    }
+    for(; lo < font->uc_sequence_count; lo++){
+        const font_sequence_t* seq = &font->uc_sequences[lo];
+        const uint32_t* seq_cps = font->uc_sequence_cps + seq->start;
+        if(seq_cps[0] != cps[0]) break;
+        if(seq->length <= count && seq->length > *consumed && memcmp(seq_cps, cps, seq->length * sizeof(uint32_t)) == 0){
+            *consumed = seq->length;
+            best = seq->glyph;
+        }
+    }
+    return best;
+}
+
+/*
+ * @brief Picks the glyph drawn for codepoints the font has no glyph for
+ * 
+ * @param font The font to change
+ * @param c The codepoint whose glyph to use, ignored if the font lacks it too
+*/
+void font_set_replacement(font_t* font, uint32_t c){
+    uint32_t glyph;
+    if(font_lookup(font, c, &glyph)) font->replacement = glyph;
+}
+
+//======== Loading ========//
+
+static _Atomic uint64_t __dt_font_ids = 1;
+
+//Reads a PSF header and checks it against size, false if anything it describes lies outside the data
+static bool __dt_psf_header(const char* data, size_t size, font_t* font, size_t* glyph_offset, bool* has_table){
+    if(size >= sizeof(psf1_header) && ((psf1_header*)data)->magic == PSF1_MAGIC){
+        psf1_header* header = (psf1_header*)data;
+        font->format = BT_FORMAT_PSF1;
+        font->glyph_count = header->mode & PSF1_MODE_512 ? 512 : 256;
+        font->suggested_width = 8;
+        font->suggested_height = header->char_size;
+        font->psfx_bytes_per_glyph = header->char_size;
+        *glyph_offset = sizeof(psf1_header);
+        *has_table = header->mode & PSF1_MODE_HASTABLE;
+    } else if(size >= sizeof(psf2_header) && ((psf2_header*)data)->magic == PSF2_MAGIC){
+        psf2_header* header = (psf2_header*)data;
+        //Newer versions may grow the header, the glyphs start where it says it ends
+        if(header->header_size < sizeof(psf2_header) || header->header_size > size) return false;
+        if(header->font_width == 0 || ((uint64_t)header->font_width + 7) / 8 * header->font_height > header->bytes_per_glyph) return false;
+        font->format = BT_FORMAT_PSF2;
+        font->glyph_count = header->glyph_count;
+        font->suggested_width = header->font_width;
+        font->suggested_height = header->font_height;
+        font->psfx_bytes_per_glyph = header->bytes_per_glyph;
+        *glyph_offset = header->header_size;
+        *has_table = header->flags & PSF2_FLAG_UC;
+    } else {
+        return false;
+    }
+
+    if(font->glyph_count == 0 || font->suggested_height == 0) return false;
+    return (uint64_t)font->glyph_count * font->psfx_bytes_per_glyph <= size - *glyph_offset;
+}
+
+//Sets up the reference count and unicode map of a checked PSF font, copying the glyphs unless they stay mapped
+static bool __dt_psf_finish(font_t* font, const char* data, size_t size, size_t glyph_offset, bool has_table, bool copy_glyphs){
+    size_t glyph_data_size = (size_t)font->glyph_count * font->psfx_bytes_per_glyph;
+    const char* glyph_data = data + glyph_offset;
+
+    //The unicode table follows the glyphs, when the header says there is one
+    __dt_uc_iter_t table = {(const uint8_t*)glyph_data + glyph_data_size, (const uint8_t*)data + size,
+                            font->format == BT_FORMAT_PSF1, 0, font->glyph_count};
+    uint8_t used_pages[0x1100 / 8];
+    uint32_t page_count, max_page, sequences, sequence_cps;
+    size_t table_size = 0;
+    if(has_table && table.p < table.end)
+        table_size = __dt_uc_measure(table, used_pages, &page_count, &max_page, &sequences, &sequence_cps);
+
+    //The reference count comes first, then the copied glyphs and the table, one allocation for all
+    size_t table_offset = (16 + (copy_glyphs ? glyph_data_size : 0) + 3) & ~(size_t)3;
+    char* block = font->alloc.malloc(table_offset + table_size);
+    if(block == NULL) return false;
+    font->refs = (_Atomic uint32_t*)block;
+    atomic_init(font->refs, 1);
+    font->id = atomic_fetch_add_explicit(&__dt_font_ids, 1, memory_order_relaxed);
+    if(copy_glyphs){
+        font->glyph_data = block + 16;
+        memcpy(font->glyph_data, glyph_data, glyph_data_size);
+    } else {
+        font->glyph_data = (char*)glyph_data;
+    }
+
+    if(table_size != 0)
+        __dt_uc_fill(font, table, (uint8_t*)block + table_offset, used_pages, page_count, max_page, sequences);
+    font_set_replacement(font, '?');
+    font_set_replacement(font, DT_REPLACEMENT_CHARACTER);
+    return true;
+}
+
+/*
+ * @brief Picks the pixel size of a TrueType font, which sizes its suggested cell
+ * 
+ * @param font The font to change, PSF fonts are left alone
+ * @param size Pixels per em
+*/
+void font_set_size(font_t* font, uint32_t size){
+    if(font->ttf == NULL || size == 0) return;
+    uint32_t line_height;
+    ttf_line_metrics(font->ttf, size, &font->ttf_ascent, &line_height);
+    font->ttf_size = size;
+    font->suggested_height = line_height;
+    font->suggested_width = (uint32_t)ceilf(font->ttf->advance_max * (float)size / font->ttf->units_per_em);
+}
+
+//Sets up a TrueType font: the file, copied unless it stays mapped, and a unicode map built from its cmap
+static bool __dt_ttf_finish(font_t* font, const char* data, size_t size, bool copy_file){
+    ttf_font_t* ttf = ttf_load(font->alloc, (const uint8_t*)data, size);
+    if(ttf == NULL) return false;
+
+    //Glyph indices have to fit the 16-bit pages, DT_NO_GLYPH marks holes
+    uint8_t used_pages[0x1100 / 8];
+    uint32_t page_count = 0, max_page = 0, c, glyph;
+    memset(used_pages, 0, sizeof(used_pages));
+    ttf_cmap_iter_t it = {0, 0};
+    while(ttf_cmap_next(ttf, &it, &c, &glyph)){
+        uint32_t page = c >> 8;
+        if(glyph >= DT_NO_GLYPH || used_pages[page / 8] & (1 << page % 8)) continue;
+        used_pages[page / 8] |= 1 << page % 8;
+        page_count++;
+        if(page > max_page) max_page = page;
+    }
+
+    size_t table_offset = (16 + (copy_file ? size : 0) + 3) & ~(size_t)3;
+    char* block = font->alloc.malloc(table_offset + __dt_uc_pages_size(page_count, max_page));
+    if(block == NULL){
+        ttf_free(ttf);
+        return false;
+    }
+    font->refs = (_Atomic uint32_t*)block;
+    atomic_init(font->refs, 1);
+    font->id = atomic_fetch_add_explicit(&__dt_font_ids, 1, memory_order_relaxed);
+    font->glyph_data = (char*)data;
+    if(copy_file){
+        //The tables are read in place, so parse them again where they now live
+        font->glyph_data = block + 16;
+        memcpy(font->glyph_data, data, size);
+        ttf_free(ttf);
+        ttf = ttf_load(font->alloc, (const uint8_t*)font->glyph_data, size);
+        if(ttf == NULL){
+            font->alloc.free(block);
+            return false;
+        }
+    }
+
+    __dt_uc_pages(font, (uint8_t*)block + table_offset, used_pages, page_count, max_page);
+    it = (ttf_cmap_iter_t){0, 0};
+    while(ttf_cmap_next(ttf, &it, &c, &glyph)){
+        uint16_t* slot = &font->uc_glyphs[(uint32_t)font->uc_pages[c >> 8] << 8 | (c & 0xFF)];
+        if(glyph < DT_NO_GLYPH && *slot == DT_NO_GLYPH) *slot = (uint16_t)glyph;
+    }
+
+    font->format = BT_FORMAT_TTF;
+    font->ttf = ttf;
+    font->glyph_count = ttf->glyph_count < DT_NO_GLYPH ? ttf->glyph_count : DT_NO_GLYPH;
+    font->replacement = 0; //.notdef, unless the font draws U+FFFD itself
+    font_set_replacement(font, DT_REPLACEMENT_CHARACTER);
+    font_set_size(font, DT_TTF_DEFAULT_SIZE);
+    return true;
+}
+
+static font_t __dt_empty_font(dazzle_allocator_t alloc){
+    font_t font;
+    memset(&font, 0, sizeof(font_t));
+    font.alloc = alloc;
+    font.format = BT_INVALID_FORMAT;
+    return font;
+}
+
+/*
+ * @brief Loads a font, copying what it needs out of data
  * 
  * @param alloc The allocator to use
  * @param data The font data
  * @param size The size of the font data
- * @param color The color of the font
- * @return font_t The font
+ * @return font_t The font, BT_INVALID_FORMAT if data isn't a font that fits in size
 */
 font_t load_font(dazzle_allocator_t alloc, char* data, uint32_t size){
-    font_t toreturn;
-
-    toreturn.alloc = alloc;
-
-    if(((psf1_header*)data)->magic == PSF1_MAGIC){
-        toreturn.format = BT_FORMAT_PSF1;
-        toreturn.glyph_count = ((psf1_header*)data)->mode & PSF1_MODE_512 ? 512 : 256;
-        toreturn.suggested_width = 8;
-        toreturn.suggested_height = ((psf1_header*)data)->char_size;
-        toreturn.psfx_bytes_per_glyph = toreturn.suggested_height;
-    }else if(((psf2_header*)data)->magic == PSF2_MAGIC){
-        toreturn.format = BT_FORMAT_PSF2;
-        toreturn.glyph_count = ((psf2_header*)data)->glyph_count;
-        toreturn.suggested_width = ((psf2_header*)data)->font_width;
-        toreturn.suggested_height = ((psf2_header*)data)->font_height;
-        toreturn.psfx_bytes_per_glyph = ((psf2_header*)data)->bytes_per_glyph;
-    } else {
-        toreturn.format = BT_INVALID_FORMAT;
-    }
+    font_t toreturn = __dt_empty_font(alloc);
+    if(data == NULL) return toreturn;
 
-    if(toreturn.format == BT_FORMAT_PSF1 || toreturn.format == BT_FORMAT_PSF2){
-        char* glyph_data = data + (toreturn.format == BT_FORMAT_PSF1 ? sizeof(psf1_header) : sizeof(psf2_header));
-        uint32_t glyph_data_size = toreturn.glyph_count * toreturn.psfx_bytes_per_glyph;
-
-        toreturn.glyph_data = alloc.malloc(glyph_data_size);
-        memcpy(toreturn.glyph_data, glyph_data, glyph_data_size);
+    if(ttf_is_font((const uint8_t*)data, size)){
+        if(!__dt_ttf_finish(&toreturn, data, size, true)) return __dt_empty_font(alloc);
+        return toreturn;
     }
 
+    size_t glyph_offset;
+    bool has_table;
+    if(!__dt_psf_header(data, size, &toreturn, &glyph_offset, &has_table) ||
+       !__dt_psf_finish(&toreturn, data, size, glyph_offset, has_table, true))
+        return __dt_empty_font(alloc);
+
     return toreturn;
 }
 
 /*
- * @brief Renders a glyph
+ * @brief Loads a font by mapping its file, the glyphs are used in place
  * 
- * @param font The font to use
- * @param c The character to create a glyph from
- * @param size The size of the glyph
- * @return glyph_t The glyph
+ * The mapping is read only and shared, so every process using the same font
+ * file shares its pages and loading costs nothing up front, however big it is.
+ * 
+ * @param alloc The allocator for the reference count and unicode map
+ * @param path The font file
+ * @return font_t The font, BT_INVALID_FORMAT if it can't be opened or isn't a valid font
 */
-glyph_t render_glyph(font_t font, uint32_t c, uint32_t size, uint32_t color){
+font_t load_font_mapped(dazzle_allocator_t alloc, const char* path){
+    font_t toreturn = __dt_empty_font(alloc);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if(fd < 0) return toreturn;
+    struct stat st;
+    if(fstat(fd, &st) != 0 || st.st_size <= 0){
+        close(fd);
+        return toreturn;
+    }
+    size_t size = (size_t)st.st_size;
+    void* map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(map == MAP_FAILED) return toreturn;
+
+    size_t glyph_offset;
+    bool has_table;
+    if(ttf_is_font(map, size) ? !__dt_ttf_finish(&toreturn, map, size, false) :
+             !__dt_psf_header(map, size, &toreturn, &glyph_offset, &has_table) ||
+             !__dt_psf_finish(&toreturn, map, size, glyph_offset, has_table, false)){
+        munmap(map, size);
+        return __dt_empty_font(alloc);
+    }
+
+    toreturn.mapping = map;
+    toreturn.mapping_size = size;
+    return toreturn;
+}
+
+//Coverage of a TrueType glyph placed in a cell of the font's line metrics at size, color scaled by it
+static glyph_t __dt_render_ttf(font_t font, uint32_t glyph, uint32_t size, uint32_t color){
+    glyph_t toreturn = {NULL, 0, 0};
+    if(size == 0) size = font.ttf_size;
+    const ttf_bitmap_t* bitmap = ttf_render(font.ttf, glyph, size);
+    if(bitmap == NULL) return toreturn;
+
+    uint32_t ascent, line_height;
+    ttf_line_metrics(font.ttf, size, &ascent, &line_height);
+    toreturn.width = (uint32_t)ceilf(font.ttf->advance_max * (float)size / font.ttf->units_per_em);
+    toreturn.height = line_height;
+    toreturn.buffer = font.alloc.malloc((size_t)toreturn.width * toreturn.height * sizeof(uint32_t));
+    if(toreturn.buffer == NULL) return toreturn;
+    memset(toreturn.buffer, 0, (size_t)toreturn.width * toreturn.height * sizeof(uint32_t));
+
+    uint32_t a = color >> 24;
+    for(uint32_t i = 0; i < bitmap->height; i++){
+        int64_t y = (int64_t)ascent + bitmap->top + i;
+        if(y < 0 || y >= toreturn.height) continue;
+        for(uint32_t j = 0; j < bitmap->width; j++){
+            int64_t x = (int64_t)bitmap->left + j;
+            uint32_t coverage = bitmap->alpha[(size_t)i * bitmap->width + j];
+            if(x < 0 || x >= toreturn.width || coverage == 0) continue;
+            toreturn.buffer[y * toreturn.width + x] = (color & 0xFFFFFF) | (coverage * a + 127) / 255 << 24;
+        }
+    }
+    return toreturn;
+}
+
+//======== Scaling ========//
+
+//Bit i of a byte spread over bits 2i and 2i + 1, or 3i to 3i + 2
+#define __DT_X2(b) (((b) & 1) * 3u | ((b) & 2) * 6u | ((b) & 4) * 12u | ((b) & 8) * 24u | \
+                    ((b) & 16) * 48u | ((b) & 32) * 96u | ((b) & 64) * 192u | ((b) & 128) * 384u)
+#define __DT_X3(b) (((b) & 1) * 7u | ((b) & 2) * 28u | ((b) & 4) * 112u | ((b) & 8) * 448u | \
+                    ((b) & 16) * 1792u | ((b) & 32) * 7168u | ((b) & 64) * 28672u | ((b) & 128) * 114688u)
+
+#define __DT_T4(f, n) f(n), f((n) + 1), f((n) + 2), f((n) + 3)
+#define __DT_T16(f, n) __DT_T4(f, n), __DT_T4(f, (n) + 4), __DT_T4(f, (n) + 8), __DT_T4(f, (n) + 12)
+#define __DT_T64(f, n) __DT_T16(f, n), __DT_T16(f, (n) + 16), __DT_T16(f, (n) + 32), __DT_T16(f, (n) + 48)
+#define __DT_T256(f) __DT_T64(f, 0), __DT_T64(f, 64), __DT_T64(f, 128), __DT_T64(f, 192)
+
+static const uint16_t __dt_bits_x2[256] = {__DT_T256(__DT_X2)};
+static const uint32_t __dt_bits_x3[256] = {__DT_T256(__DT_X3)};
+
+//Widens one most significant bit first row of width pixels, a table lookup per source byte. 4x doubles twice.
+static void __dt_scale_row(const uint8_t* src, uint32_t width, uint32_t scale, uint8_t* dst){
+    uint32_t bytes = (width + 7) / 8;
+    switch(scale){
+        case 2:
+            for(uint32_t i = 0; i < bytes; i++, dst += 2){
+                uint16_t v = __dt_bits_x2[src[i]];
+                dst[0] = v >> 8;
+                dst[1] = v;
+            }
+            break;
+        case 3:
+            for(uint32_t i = 0; i < bytes; i++, dst += 3){
+                uint32_t v = __dt_bits_x3[src[i]];
+                dst[0] = v >> 16;
+                dst[1] = v >> 8;
+                dst[2] = v;
+            }
+            break;
+        case 4:
+            for(uint32_t i = 0; i < bytes; i++, dst += 4){
+                uint16_t v = __dt_bits_x2[src[i]], hi = __dt_bits_x2[v >> 8], lo = __dt_bits_x2[v & 0xFF];
+                dst[0] = hi >> 8;
+                dst[1] = hi;
+                dst[2] = lo >> 8;
+                dst[3] = lo;
+            }
+            break;
+        default:
+            memcpy(dst, src, bytes);
+            break;
+    }
+}
+
+//A bitmap glyph scaled into dst, (suggested_width * scale + 7) / 8 bytes per row and suggested_height * scale rows
+static void __dt_scale_glyph(const font_t* font, uint32_t glyph, uint32_t scale, uint8_t* dst){
+    uint32_t width_bytes = (font->suggested_width + 7) / 8, stride = (font->suggested_width * scale + 7) / 8;
+    const uint8_t* bits = (const uint8_t*)font->glyph_data + (size_t)glyph * font->psfx_bytes_per_glyph;
+    for(uint32_t i = 0; i < font->suggested_height; i++, bits += width_bytes){
+        __dt_scale_row(bits, font->suggested_width, scale, dst);
+        //Every copy of the row after the first is a plain copy
+        for(uint32_t s = 1; s < scale; s++)
+            memcpy(dst + (size_t)s * stride, dst, stride);
+        dst += (size_t)scale * stride;
+    }
+}
+
+//The whole multiple closest below size for bitmap fonts, from 1 to DT_MAX_SCALE
+static inline uint32_t __dt_scale_for(const font_t* font, uint32_t size){
+    uint32_t scale = font->suggested_height == 0 ? 1 : size / font->suggested_height;
+    return scale < 1 ? 1 : scale > DT_MAX_SCALE ? DT_MAX_SCALE : scale;
+}
+
+//======== Rendering ========//
+
+//Expands glyph number glyph, not a codepoint, into dazzle colors
+static glyph_t __dt_render_index(font_t font, uint32_t glyph, uint32_t scale, uint32_t color){
     glyph_t toreturn = {NULL, 0, 0};
-    if(font.format == BT_INVALID_FORMAT) return toreturn;
-
-    if(font.format == BT_FORMAT_PSF1 || font.format == BT_FORMAT_PSF2){
-        toreturn.width = font.suggested_width;
-        toreturn.height = font.suggested_height;
-        toreturn.buffer = font.alloc.malloc(toreturn.width * toreturn.height * sizeof(uint32_t));
-        uint8_t* glyph_ptr = (uint8_t*)font.glyph_data + (c * font.psfx_bytes_per_glyph); 
-        uint8_t width_bytes = toreturn.width % 8 == 0 ? toreturn.width / 8 : ((toreturn.width / 8) + 1);
+    if(font.format == BT_FORMAT_TTF && glyph < font.glyph_count) return __dt_render_ttf(font, glyph, font.ttf_size * scale, color);
+
+    if((font.format == BT_FORMAT_PSF1 || font.format == BT_FORMAT_PSF2) && glyph < font.glyph_count){
+        toreturn.width = font.suggested_width * scale;
+        toreturn.height = font.suggested_height * scale;
+        uint32_t width_bytes = (toreturn.width + 7) / 8;
+        toreturn.buffer = font.alloc.malloc((size_t)toreturn.width * toreturn.height * sizeof(uint32_t) + (scale > 1 ? (size_t)width_bytes * toreturn.height : 0));
+        if(toreturn.buffer == NULL) return toreturn;
+        uint8_t* glyph_ptr = (uint8_t*)font.glyph_data + (glyph * font.psfx_bytes_per_glyph);
+        if(scale > 1){
+            //Scaled bits go behind the pixels, read before anything is written over them
+            glyph_ptr = (uint8_t*)(toreturn.buffer + (size_t)toreturn.width * toreturn.height);
+            __dt_scale_glyph(&font, glyph, scale, glyph_ptr);
+        }
         for(uint32_t i = 0; i < toreturn.height; i++){
             for(uint32_t j = 0; j < toreturn.width; j++){
                 if((glyph_ptr[i * width_bytes + j / 8] >> (7 - j % 8)) & 1){
@@ -145,4 +689,250 @@ glyph_t render_glyph(font_t font, uint32_t c, uint32_t size, uint32_t color){
     return toreturn;
 }
 
+/*
+ * @brief Renders a glyph
+ * 
+ * @param font The font to use
+ * @param c The character to create a glyph from, missing ones get the replacement glyph
+ * @param size Pixels per em for TrueType fonts, 0 for the font's size. Bitmap fonts are scaled
+ *             by the largest whole multiple of their height that fits, up to DT_MAX_SCALE.
+ * @return glyph_t The glyph, TrueType coverage goes into the alpha channel
+*/
+glyph_t render_glyph(font_t font, uint32_t c, uint32_t size, uint32_t color){
+    DAZZLE_TRACE_SCOPE("render_glyph");
+    if(font.format == BT_INVALID_FORMAT) return (glyph_t){NULL, 0, 0};
+    if(font.format == BT_FORMAT_TTF) return __dt_render_ttf(font, font_glyph_index(&font, c), size, color);
+    return __dt_render_index(font, font_glyph_index(&font, c), __dt_scale_for(&font, size), color);
+}
+
+bool draw_glyph_index(dazzle_context_t* ctx, font_t font, uint32_t glyph, uint32_t x, uint32_t y, uint32_t scale, uint32_t fg, uint32_t bg);
+
+/*
+ * @brief Draws a glyph at a whole multiple of its size
+ * 
+ * Bitmap rows are widened through lookup tables and drawn as one 1bpp bitmap,
+ * so a scaled glyph costs the same per pixel as an unscaled one. TrueType
+ * glyphs are rasterized at the scaled size instead, which stays sharp.
+ * 
+ * @param ctx The context to draw into
+ * @param font The font to use
+ * @param c The character to draw
+ * @param x The left edge
+ * @param y The top edge
+ * @param scale 1 to DT_MAX_SCALE
+ * @param fg The color of the glyph
+ * @param bg The color behind it, zero alpha leaves the background alone
+ * @return bool False if the glyph could not be drawn
+*/
+bool draw_glyph_scaled(dazzle_context_t* ctx, font_t font, uint32_t c, uint32_t x, uint32_t y, uint32_t scale, uint32_t fg, uint32_t bg){
+    if(font.format == BT_INVALID_FORMAT) return false;
+    return draw_glyph_index(ctx, font, font_glyph_index(&font, c), x, y, scale, fg, bg);
+}
+
+/*
+ * @brief Draws a glyph by its number in the font, see draw_glyph_scaled
+ * 
+ * @param ctx The context to draw into
+ * @param font The font to use
+ * @param glyph The glyph number, as returned by font_glyph_index
+ * @param x The left edge
+ * @param y The top edge
+ * @param scale 1 to DT_MAX_SCALE
+ * @param fg The color of the glyph
+ * @param bg The color behind it, zero alpha leaves the background alone
+ * @return bool False if the glyph could not be drawn
+*/
+bool draw_glyph_index(dazzle_context_t* ctx, font_t font, uint32_t glyph, uint32_t x, uint32_t y, uint32_t scale, uint32_t fg, uint32_t bg){
+    if(font.format == BT_INVALID_FORMAT || scale == 0 || scale > DT_MAX_SCALE || glyph >= font.glyph_count) return false;
+
+    if(font.format == BT_FORMAT_TTF){
+        uint32_t size = font.ttf_size * scale, ascent = font.ttf_ascent, line_height;
+        if(scale > 1) ttf_line_metrics(font.ttf, size, &ascent, &line_height);
+        const ttf_bitmap_t* bitmap = ttf_render(font.ttf, glyph, size);
+        if(bitmap == NULL) return false;
+        bool success = true;
+        if(bg >> 24) success = dazzle_fill_rect(ctx, x, y, font.suggested_width * scale, font.suggested_height * scale, bg);
+
+        //Outlines may reach past the cell's top left, only what is on screen gets drawn
+        int64_t gx = (int64_t)x + bitmap->left, gy = (int64_t)y + ascent + bitmap->top;
+        uint32_t skip_x = gx < 0 ? (uint32_t)-gx : 0, skip_y = gy < 0 ? (uint32_t)-gy : 0;
+        if(skip_x >= bitmap->width || skip_y >= bitmap->height) return success;
+        return dazzle_draw_alpha(ctx, (uint32_t)(gx + skip_x), (uint32_t)(gy + skip_y), bitmap->width - skip_x, bitmap->height - skip_y,
+                                 bitmap->alpha + (size_t)skip_y * bitmap->width + skip_x, bitmap->width, fg) && success;
+    }
+
+    const uint8_t* glyph_ptr = (const uint8_t*)font.glyph_data + (glyph * font.psfx_bytes_per_glyph);
+    if(scale == 1)
+        return dazzle_draw_mono(ctx, x, y, font.suggested_width, font.suggested_height, glyph_ptr, (font.suggested_width + 7) / 8, fg, bg);
+
+    //Console sized glyphs fit on the stack, anything bigger gets a buffer
+    uint8_t local[2048];
+    uint32_t stride = (font.suggested_width * scale + 7) / 8;
+    size_t size = (size_t)stride * font.suggested_height * scale;
+    uint8_t* bits = size <= sizeof(local) ? local : font.alloc.malloc(size);
+    if(bits == NULL) return false;
+    __dt_scale_glyph(&font, glyph, scale, bits);
+    bool success = dazzle_draw_mono(ctx, x, y, font.suggested_width * scale, font.suggested_height * scale, bits, stride, fg, bg);
+    if(bits != local) font.alloc.free(bits);
+    return success;
+}
+
+/*
+ * @brief Draws a glyph into a box of a given size, nothing of it lands outside
+ * 
+ * For cells of a grid set in another font: the glyph's own line is centered
+ * vertically in the box and cut off where it does not fit, so neighbouring
+ * cells can be redrawn in any order.
+ * 
+ * @param ctx The context to draw into
+ * @param font The font to use
+ * @param glyph The glyph number, as returned by font_glyph_index
+ * @param x The left edge of the box
+ * @param y The top edge of the box
+ * @param w The width of the box
+ * @param h The height of the box
+ * @param fg The color of the glyph
+ * @param bg The color of the whole box, zero alpha leaves the background alone
+ * @return bool False if the glyph could not be drawn
+*/
+bool draw_glyph_cell(dazzle_context_t* ctx, font_t font, uint32_t glyph, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint32_t fg, uint32_t bg){
+    if(font.format == BT_INVALID_FORMAT || glyph >= font.glyph_count) return false;
+    bool ttf = font.format == BT_FORMAT_TTF;
+    if(!ttf && font.suggested_width == w && font.suggested_height == h) return draw_glyph_index(ctx, font, glyph, x, y, 1, fg, bg);
+
+    bool success = true;
+    if(bg >> 24) success = dazzle_fill_rect(ctx, x, y, w, h, bg);
+    int64_t top = ((int64_t)h - font.suggested_height) / 2;
+
+    //Where the glyph's pixels are relative to the box, then clipped to it
+    int64_t gx = 0, gy = top, gw = font.suggested_width, gh = font.suggested_height;
+    const ttf_bitmap_t* bitmap = NULL;
+    if(ttf){
+        bitmap = ttf_render(font.ttf, glyph, font.ttf_size);
+        if(bitmap == NULL) return false;
+        gx = bitmap->left;
+        gy = top + font.ttf_ascent + bitmap->top;
+        gw = bitmap->width;
+        gh = bitmap->height;
+    }
+    int64_t x0 = gx < 0 ? 0 : gx, y0 = gy < 0 ? 0 : gy;
+    int64_t x1 = gx + gw > w ? w : gx + gw, y1 = gy + gh > h ? h : gy + gh;
+    if(x0 >= x1 || y0 >= y1) return success;
+
+    if(ttf)
+        return dazzle_draw_alpha(ctx, x + x0, y + y0, x1 - x0, y1 - y0, bitmap->alpha + (size_t)(y0 - gy) * gw + (x0 - gx), gw, fg) && success;
+
+    //Bitmap rows start on whole bytes, so only rows are skipped and the width is cut
+    uint32_t stride = (font.suggested_width + 7) / 8;
+    const uint8_t* bits = (const uint8_t*)font.glyph_data + glyph * font.psfx_bytes_per_glyph + (size_t)(y0 - gy) * stride;
+    return dazzle_draw_mono(ctx, x, y + y0, x1, y1 - y0, bits, stride, fg, 0) && success;
+}
+
+/*
+ * @brief Draws a glyph straight from the font's bitmap, without an intermediate buffer
+ * 
+ * TrueType glyphs are rasterized once per size and blended from the cached
+ * coverage, with their baseline at the font's ascent below y.
+ * 
+ * @param ctx The context to draw into
+ * @param font The font to use
+ * @param c The character to draw
+ * @param x The left edge
+ * @param y The top edge
+ * @param fg The color of the glyph
+ * @param bg The color behind it, zero alpha leaves the background alone
+ * @return bool False if the glyph could not be drawn
+*/
+bool draw_glyph(dazzle_context_t* ctx, font_t font, uint32_t c, uint32_t x, uint32_t y, uint32_t fg, uint32_t bg){
+    return draw_glyph_scaled(ctx, font, c, x, y, 1, fg, bg);
+}
+
+/*
+ * @brief Shares a font, the copy returned uses the same glyph data
+ * 
+ * @param font The font to share
+ * @return font_t The same font, holding one more reference
+*/
+font_t font_retain(font_t font){
+    if(font.refs != NULL) atomic_fetch_add_explicit(font.refs, 1, memory_order_relaxed);
+    return font;
+}
+
+/*
+ * @brief Drops a reference to a font, the last one frees its glyph data or unmaps its file
+ * 
+ * @param font The font to release, invalid afterwards
+*/
+void font_release(font_t* font){
+    if(font->refs != NULL && atomic_fetch_sub_explicit(font->refs, 1, memory_order_acq_rel) == 1){
+        if(font->ttf != NULL) ttf_free(font->ttf);
+        if(font->mapping != NULL) munmap(font->mapping, font->mapping_size);
+        font->alloc.free((void*)font->refs);
+    }
+    font->refs = NULL;
+    font->glyph_data = NULL;
+    font->ttf = NULL;
+    font->format = BT_INVALID_FORMAT;
+}
+
+/*
+ * @brief Renders every glyph of a font once, for any number of contexts to blit
+ * 
+ * @param font The font to use, the set keeps a reference to it
+ * @param color The color of the glyphs
+ * @return glyph_set_t* The glyphs, or NULL on failure
+*/
+glyph_set_t* create_glyph_set(font_t font, uint32_t color){
+    if(font.format == BT_INVALID_FORMAT) return NULL;
+
+    glyph_set_t* set = font.alloc.malloc(sizeof(glyph_set_t));
+    if(set == NULL) return NULL;
+    set->glyphs = font.alloc.malloc(font.glyph_count * sizeof(dazzle_image_t*));
+    if(set->glyphs == NULL){
+        font.alloc.free(set);
+        return NULL;
+    }
+
+    atomic_init(&set->refs, 1);
+    set->font = font_retain(font);
+    set->color = color;
+    set->count = 0;
+
+    for(uint32_t i = 0; i < font.glyph_count; i++){
+        glyph_t glyph = __dt_render_index(font, i, 1, color);
+        set->glyphs[i] = glyph.buffer == NULL ? NULL : dazzle_image_create(font.alloc, glyph.width, glyph.height, glyph.buffer);
+        if(glyph.buffer != NULL) font.alloc.free(glyph.buffer);
+        set->count++;
+    }
+
+    return set;
+}
+
+/*
+ * @brief Takes another reference to a glyph set
+ * 
+ * @param set The set to share
+ * @return glyph_set_t* The same set
+*/
+glyph_set_t* glyph_set_retain(glyph_set_t* set){
+    atomic_fetch_add_explicit(&set->refs, 1, memory_order_relaxed);
+    return set;
+}
+
+/*
+ * @brief Drops a reference to a glyph set, the last one frees it
+ * 
+ * @param set The set to release
+*/
+void glyph_set_release(glyph_set_t* set){
+    if(set == NULL || atomic_fetch_sub_explicit(&set->refs, 1, memory_order_acq_rel) != 1) return;
+
+    dazzle_allocator_t alloc = set->font.alloc;
+    for(uint32_t i = 0; i < set->count; i++)
+        dazzle_image_release(set->glyphs[i]);
+    font_release(&set->font);
+    alloc.free(set->glyphs);
+    alloc.free(set);
+}
+
 #endif // __DT_GLYPHS_H__
\ No newline at end of file
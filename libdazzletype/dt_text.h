@@ -0,0 +1,439 @@
+#ifndef __DT_TEXT_H__
+#define __DT_TEXT_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include <dazzle.h>
+#include "dt_glyphs.h"
+#include "dt_fallback.h"
+
+#ifdef __DAZZLE_IMPL__
+    #define __UTF8_IMPL__
+#endif
+#include "../utils/utf8.h"
+
+//======== Defines ========//
+
+#define DT_TEXT_MAX_RUN 256   //codepoints resolved at a time, lines can be longer
+#define DT_TEXT_MAX_WIDTH 16384
+
+//======== Structure Definitions ========//
+
+//A block of text rendered once into a bitmap, drawn in one call until the text changes
+typedef struct {
+    font_t font;
+    uint32_t x;
+    uint32_t y;
+    uint32_t fg;
+    uint32_t bg;
+
+    char* text;
+    size_t length;
+
+    //1bpp for bitmap fonts, 8-bit coverage for TrueType
+    uint8_t* pixels;
+    uint32_t width;
+    uint32_t height;
+    uint32_t stride;
+    bool stale;
+} text_element_t;
+
+//======== Layout ========//
+
+typedef struct {
+    const uint8_t* p;
+    const uint8_t* end;
+    utf8_dec_state_t state;
+    const uint8_t* line_end; //the next '\n' or end, found once per line
+} __dt_text_iter_t;
+
+//Decodes up to max codepoints of the current line, false once the text is used up.
+//Broken UTF-8 becomes U+FFFD, newline is set when the line ended with '\n'.
+static bool __dt_text_run(__dt_text_iter_t* it, uint32_t* cps, uint32_t max, uint32_t* count, bool* newline){
+    *count = 0;
+    *newline = false;
+    if(it->p >= it->end && it->state.bytes_remaining == 0) return false;
+
+    if(it->line_end == NULL || it->line_end < it->p){
+        it->line_end = memchr(it->p, '\n', it->end - it->p);
+        if(it->line_end == NULL) it->line_end = it->end;
+    }
+
+    //The line is decoded in bulk, '\r' is dropped afterwards when there is one
+    const uint8_t* start = it->p;
+    size_t used;
+    uint32_t n = utf8_decode_buf(&it->state, it->p, it->line_end - it->p, cps, max, &used);
+    it->p += used;
+    if(memchr(start, '\r', used) != NULL){
+        uint32_t kept = 0;
+        for(uint32_t i = 0; i < n; i++)
+            if(cps[i] != '\r') cps[kept++] = cps[i];
+        n = kept;
+    }
+
+    if(it->p == it->line_end){
+        //Cut short by the newline or the end of the text
+        if(it->state.bytes_remaining != 0 && n < max){
+            it->state = (utf8_dec_state_t){0, 0, 0};
+            cps[n++] = DT_REPLACEMENT_CHARACTER;
+        }
+        if(it->state.bytes_remaining == 0 && it->p < it->end){
+            it->p++;
+            *newline = true;
+        }
+    }
+    *count = n;
+    return true;
+}
+
+//What lines are set in: one font, or a chain that picks one of its fonts per character
+typedef struct {
+    const font_t* fonts;
+    const font_chain_t* chain; //NULL for a single font
+    uint32_t height;           //of a line, the first font's
+    uint32_t max_width;        //widest bitmap cell, the room a partly visible glyph needs
+    bool alpha;                //a TrueType font is involved, lines are 8-bit coverage instead of 1bpp
+} __dt_text_fonts_t;
+
+static __dt_text_fonts_t __dt_text_fonts(const font_t* fonts, uint32_t count, const font_chain_t* chain){
+    __dt_text_fonts_t tf = {fonts, chain, fonts[0].suggested_height, 0, false};
+    for(uint32_t i = 0; i < count; i++){
+        if(fonts[i].format == BT_FORMAT_TTF) tf.alpha = true;
+        else if(fonts[i].suggested_width > tf.max_width) tf.max_width = fonts[i].suggested_width;
+    }
+    return tf;
+}
+
+//Turns codepoints into glyphs in place and notes which font each one is from.
+//Sequences the first font has one glyph for are combined, a chain resolves the rest.
+static uint32_t __dt_text_glyphs(const __dt_text_fonts_t* tf, uint32_t* cps, uint8_t* which, uint32_t count){
+    uint32_t n = 0;
+    for(uint32_t i = 0, used; i < count; i += used){
+        uint32_t font = 0, glyph = font_glyph_index_seq(&tf->fonts[0], cps + i, count - i, &used);
+        if(tf->chain != NULL && used == 1) glyph = font_chain_glyph(tf->chain, cps[i], &font);
+        cps[n] = glyph;
+        which[n++] = (uint8_t)font;
+    }
+    return n;
+}
+
+//Ors a bitmap glyph into a 1bpp line at pixel pen, returns the pen after it
+static uint32_t __dt_compose_mono(const font_t* font, uint32_t glyph, uint32_t height, uint8_t* bits, uint32_t stride, uint32_t pen){
+    uint32_t w = font->suggested_width, width_bytes = (w + 7) / 8;
+    uint32_t rows = font->suggested_height < height ? font->suggested_height : height;
+    uint8_t last_mask = (uint8_t)(0xFF00 >> (w % 8 == 0 ? 8 : w % 8));
+    const uint8_t* src = (const uint8_t*)font->glyph_data + (size_t)glyph * font->psfx_bytes_per_glyph;
+    uint32_t shift = pen % 8;
+
+    for(uint32_t i = 0; i < rows; i++, src += width_bytes){
+        uint8_t* dst = bits + (size_t)i * stride + pen / 8;
+        for(uint32_t k = 0; k < width_bytes; k++){
+            uint8_t b = k + 1 == width_bytes ? src[k] & last_mask : src[k];
+            dst[k] |= b >> shift;
+            //Only bits that are set spill into the next byte, so nothing past the glyph is touched
+            if(shift != 0 && (uint8_t)(b << (8 - shift))) dst[k + 1] |= (uint8_t)(b << (8 - shift));
+        }
+    }
+    return pen + w;
+}
+
+//Sets a bitmap glyph's pixels to full coverage in an 8-bit line, for bitmap fonts chained with TrueType ones
+static uint32_t __dt_compose_bits(const font_t* font, uint32_t glyph, uint32_t height, uint8_t* alpha, uint32_t stride, uint32_t pen, uint32_t limit, uint32_t* right){
+    uint32_t w = font->suggested_width, width_bytes = (w + 7) / 8;
+    uint32_t rows = font->suggested_height < height ? font->suggested_height : height;
+    uint32_t visible = pen + w > limit ? limit - pen : w;
+    const uint8_t* src = (const uint8_t*)font->glyph_data + (size_t)glyph * font->psfx_bytes_per_glyph;
+
+    for(uint32_t i = 0; i < rows; i++, src += width_bytes){
+        uint8_t* dst = alpha + (size_t)i * stride + pen;
+        for(uint32_t j = 0; j < visible; j++)
+            if(src[j / 8] & (0x80 >> j % 8)) dst[j] = 255;
+    }
+    if(pen + visible > *right) *right = pen + visible;
+    return pen + w;
+}
+
+//Adds TrueType coverage into an 8-bit line, clipped to limit pixels. Returns the pen, *right grows to the inked edge.
+static uint32_t __dt_compose_ttf(const font_t* font, uint32_t glyph, uint32_t height, uint8_t* alpha, uint32_t stride, uint32_t pen, uint32_t limit, uint32_t* right){
+    const ttf_bitmap_t* b = ttf_render(font->ttf, glyph, font->ttf_size);
+    if(b == NULL) return pen;
+    for(uint32_t i = 0; i < b->height; i++){
+        int64_t y = (int64_t)font->ttf_ascent + b->top + i;
+        if(y < 0 || y >= height) continue;
+        const uint8_t* src = b->alpha + (size_t)i * b->width;
+        uint8_t* dst = alpha + (size_t)y * stride;
+        for(uint32_t j = 0; j < b->width; j++){
+            int64_t x = (int64_t)pen + b->left + j;
+            if(x < 0 || x >= limit || src[j] == 0) continue;
+            uint32_t sum = dst[x] + src[j];
+            dst[x] = sum > 255 ? 255 : sum;
+            if((uint32_t)x + 1 > *right) *right = (uint32_t)x + 1;
+        }
+    }
+    return pen + b->advance;
+}
+
+//Lays glyphs into a line from pixel pen on, clipped to limit. Returns the pen, *right grows to the drawn edge.
+static uint32_t __dt_compose(const __dt_text_fonts_t* tf, const uint32_t* glyphs, const uint8_t* which, uint32_t count, uint8_t* line, uint32_t stride, uint32_t pen, uint32_t limit, uint32_t* right){
+    for(uint32_t g = 0; g < count && pen < limit; g++){
+        const font_t* font = &tf->fonts[which[g]];
+        if(font->format == BT_FORMAT_TTF) pen = __dt_compose_ttf(font, glyphs[g], tf->height, line, stride, pen, limit, right);
+        else if(tf->alpha) pen = __dt_compose_bits(font, glyphs[g], tf->height, line, stride, pen, limit, right);
+        else pen = *right = __dt_compose_mono(font, glyphs[g], tf->height, line, stride, pen);
+    }
+    return pen;
+}
+
+//Width of the widest line and the number of lines, laid out without clipping
+static void __dt_text_measure(const __dt_text_fonts_t* tf, const char* utf8, size_t len, uint32_t* width, uint32_t* lines){
+    __dt_text_iter_t it = {(const uint8_t*)utf8, (const uint8_t*)utf8 + len, {0, 0, 0}, NULL};
+    uint32_t cps[DT_TEXT_MAX_RUN], count, pen = 0;
+    uint8_t which[DT_TEXT_MAX_RUN];
+    bool newline, line_start = true;
+    *width = 0;
+    *lines = 0;
+
+    while(__dt_text_run(&it, cps, DT_TEXT_MAX_RUN, &count, &newline)){
+        if(line_start) (*lines)++;
+        line_start = newline;
+        count = __dt_text_glyphs(tf, cps, which, count);
+        for(uint32_t g = 0; g < count; g++){
+            const font_t* font = &tf->fonts[which[g]];
+            if(font->format != BT_FORMAT_TTF){
+                pen += font->suggested_width;
+                continue;
+            }
+            //Overhangs count too, the last glyph may reach past its advance
+            const ttf_bitmap_t* b = ttf_render(font->ttf, cps[g], font->ttf_size);
+            if(b == NULL) continue;
+            int64_t edge = (int64_t)pen + b->left + b->width;
+            if(edge > *width) *width = edge > DT_TEXT_MAX_WIDTH ? DT_TEXT_MAX_WIDTH : (uint32_t)edge;
+            pen += b->advance;
+        }
+        if(pen > *width) *width = pen > DT_TEXT_MAX_WIDTH ? DT_TEXT_MAX_WIDTH : pen;
+        if(newline) pen = 0;
+    }
+}
+
+//Draws text line by line, see draw_text
+static bool __dt_draw_text(dazzle_context_t* ctx, const __dt_text_fonts_t* tf, uint32_t x, uint32_t y, const char* utf8, size_t len, uint32_t fg, uint32_t bg){
+    dazzle_framebuffer_t* fb = (dazzle_framebuffer_t*)ctx->renderer_data;
+    if(x >= fb->width || y >= fb->height) return true;
+
+    //One line buffer sized to what can be seen, bitmap fonts get room for a partly visible glyph
+    dazzle_allocator_t alloc = tf->fonts[0].alloc;
+    uint32_t limit = fb->width - x, h = tf->height;
+    uint32_t stride = tf->alpha ? limit : (limit + tf->max_width + 8) / 8;
+    uint8_t* line = alloc.malloc((size_t)stride * h);
+    if(line == NULL) return false;
+    memset(line, 0, (size_t)stride * h);
+
+    __dt_text_iter_t it = {(const uint8_t*)utf8, (const uint8_t*)utf8 + len, {0, 0, 0}, NULL};
+    uint32_t cps[DT_TEXT_MAX_RUN], count, pen = 0, right = 0;
+    uint8_t which[DT_TEXT_MAX_RUN];
+    bool newline, success = true;
+    for(;;){
+        bool more = __dt_text_run(&it, cps, DT_TEXT_MAX_RUN, &count, &newline);
+        if(more && pen < limit){
+            count = __dt_text_glyphs(tf, cps, which, count);
+            pen = __dt_compose(tf, cps, which, count, line, stride, pen, limit, &right);
+        }
+        if(more && !newline) continue;
+
+        //The line is done, draw it and clear what it used for the next one
+        size_t used = tf->alpha ? right : (right + 7) / 8;
+        uint32_t width = (pen < limit ? pen : limit) > right ? (pen < limit ? pen : limit) : right;
+        if(tf->alpha){
+            if((bg >> 24) && width != 0) success &= dazzle_fill_rect(ctx, x, y, width, h, bg);
+            if(right != 0) success &= dazzle_draw_alpha(ctx, x, y, right, h, line, stride, fg);
+        } else if(width != 0){
+            success &= dazzle_draw_mono(ctx, x, y, width, h, line, stride, fg, bg);
+        }
+        for(uint32_t i = 0; i < h && used != 0; i++)
+            memset(line + (size_t)i * stride, 0, used);
+        pen = right = 0;
+
+        y += h;
+        if(!more || y >= fb->height) break;
+    }
+
+    alloc.free(line);
+    return success;
+}
+
+//======== Functions ========//
+
+/*
+ * @brief Draws UTF-8 text, one batched draw per line
+ *
+ * Each line is resolved to glyphs and composed into a single bitmap, clipped
+ * to the target, then drawn with one dazzle_draw_mono or dazzle_draw_alpha
+ * call instead of one call per glyph. '\n' starts a new line.
+ *
+ * @param ctx The context to draw into
+ * @param font The font to use
+ * @param x The left edge
+ * @param y The top edge of the first line
+ * @param utf8 The text, broken sequences are drawn as the replacement glyph
+ * @param len The length of the text in bytes
+ * @param fg The color of the text
+ * @param bg The color behind it, zero alpha leaves the background alone
+ * @return bool False if the font is invalid or memory ran out
+*/
+bool draw_text(dazzle_context_t* ctx, font_t font, uint32_t x, uint32_t y, const char* utf8, size_t len, uint32_t fg, uint32_t bg){
+    DAZZLE_TRACE_SCOPE("draw_text");
+    if(font.format == BT_INVALID_FORMAT || ctx->renderer_data == NULL || utf8 == NULL) return false;
+    __dt_text_fonts_t tf = __dt_text_fonts(&font, 1, NULL);
+    return __dt_draw_text(ctx, &tf, x, y, utf8, len, fg, bg);
+}
+
+/*
+ * @brief Draws UTF-8 text with a fallback chain, see draw_text
+ *
+ * Every character comes from the first font of the chain that has it. Lines
+ * are as high as the first font's cells, taller glyphs are cut off.
+ *
+ * @param ctx The context to draw into
+ * @param chain The fonts to use
+ * @param x The left edge
+ * @param y The top edge of the first line
+ * @param utf8 The text
+ * @param len The length of the text in bytes
+ * @param fg The color of the text
+ * @param bg The color behind it, zero alpha leaves the background alone
+ * @return bool False if memory ran out
+*/
+bool draw_text_chain(dazzle_context_t* ctx, const font_chain_t* chain, uint32_t x, uint32_t y, const char* utf8, size_t len, uint32_t fg, uint32_t bg){
+    DAZZLE_TRACE_SCOPE("draw_text_chain");
+    if(chain == NULL || ctx->renderer_data == NULL || utf8 == NULL) return false;
+    __dt_text_fonts_t tf = __dt_text_fonts(chain->fonts, chain->count, chain);
+    return __dt_draw_text(ctx, &tf, x, y, utf8, len, fg, bg);
+}
+
+/*
+ * @brief Changes the text of an element, the same text again costs a compare
+ *
+ * @param text The element
+ * @param utf8 The new text
+ * @param len Its length in bytes
+ * @return bool False if memory ran out, the old text stays then
+*/
+bool text_element_set(text_element_t* text, const char* utf8, size_t len){
+    if(text->text != NULL && text->length == len && memcmp(text->text, utf8, len) == 0) return true;
+
+    char* copy = text->font.alloc.malloc(len + 1);
+    if(copy == NULL) return false;
+    memcpy(copy, utf8, len);
+    copy[len] = 0;
+    if(text->text != NULL) text->font.alloc.free(text->text);
+    text->text = copy;
+    text->length = len;
+    text->stale = true;
+    return true;
+}
+
+/*
+ * @brief Creates a retained block of text, rendered on its first draw
+ *
+ * @param font The font to use, the element keeps a reference to it
+ * @param x The left edge
+ * @param y The top edge
+ * @param utf8 The text
+ * @param len The length of the text in bytes
+ * @param fg The color of the text
+ * @param bg The color of the element's whole box behind the text, zero alpha leaves the background alone
+ * @return text_element_t* The element, or NULL on failure
+*/
+text_element_t* create_text_element(font_t font, uint32_t x, uint32_t y, const char* utf8, size_t len, uint32_t fg, uint32_t bg){
+    if(font.format == BT_INVALID_FORMAT) return NULL;
+    text_element_t* text = font.alloc.malloc(sizeof(text_element_t));
+    if(text == NULL) return NULL;
+    memset(text, 0, sizeof(text_element_t));
+    text->font = font_retain(font);
+    text->x = x;
+    text->y = y;
+    text->fg = fg;
+    text->bg = bg;
+    if(!text_element_set(text, utf8, len)){
+        font_release(&text->font);
+        font.alloc.free(text);
+        return NULL;
+    }
+    return text;
+}
+
+//Lays the whole text out into the element's bitmap
+static bool __dt_text_element_render(text_element_t* text){
+    DAZZLE_TRACE_SCOPE("text_element_render");
+    font_t* font = &text->font;
+    __dt_text_fonts_t tf = __dt_text_fonts(font, 1, NULL);
+    bool ttf = tf.alpha;
+    uint32_t width, lines, h = tf.height;
+    __dt_text_measure(&tf, text->text, text->length, &width, &lines);
+
+    //Bitmap glyphs are not clipped, the last one may start just before the width cap
+    uint32_t stride = ttf ? width : (width + tf.max_width + 8) / 8;
+    size_t size = (size_t)stride * h * lines;
+    uint8_t* pixels = size == 0 ? NULL : font->alloc.malloc(size);
+    if(size != 0 && pixels == NULL) return false;
+    if(pixels != NULL) memset(pixels, 0, size);
+
+    __dt_text_iter_t it = {(const uint8_t*)text->text, (const uint8_t*)text->text + text->length, {0, 0, 0}, NULL};
+    uint32_t cps[DT_TEXT_MAX_RUN], count, pen = 0, right = 0, line = 0;
+    uint8_t which[DT_TEXT_MAX_RUN];
+    bool newline;
+    while(pixels != NULL && line < lines && __dt_text_run(&it, cps, DT_TEXT_MAX_RUN, &count, &newline)){
+        count = __dt_text_glyphs(&tf, cps, which, count);
+        uint8_t* row = pixels + (size_t)line * h * stride;
+        pen = __dt_compose(&tf, cps, which, count, row, stride, pen, width, &right);
+        if(newline){
+            pen = 0;
+            line++;
+        }
+    }
+
+    if(text->pixels != NULL) font->alloc.free(text->pixels);
+    text->pixels = pixels;
+    text->width = width;
+    text->height = h * lines;
+    text->stride = stride;
+    text->stale = false;
+    return true;
+}
+
+/*
+ * @brief Draws a text element, rendering it again only if its text changed
+ *
+ * @param ctx The context to draw into
+ * @param text The element
+ * @return bool False if rendering or drawing failed
+*/
+bool text_element_draw(dazzle_context_t* ctx, text_element_t* text){
+    if(text->stale && !__dt_text_element_render(text)) return false;
+    if(text->pixels == NULL) return true;
+
+    if(text->font.format != BT_FORMAT_TTF)
+        return dazzle_draw_mono(ctx, text->x, text->y, text->width, text->height, text->pixels, text->stride, text->fg, text->bg);
+
+    bool success = true;
+    if(text->bg >> 24) success = dazzle_fill_rect(ctx, text->x, text->y, text->width, text->height, text->bg);
+    return dazzle_draw_alpha(ctx, text->x, text->y, text->width, text->height, text->pixels, text->stride, text->fg) && success;
+}
+
+/*
+ * @brief Frees a text element and drops its font reference
+ *
+ * @param text The element
+*/
+void text_element_destroy(text_element_t* text){
+    if(text == NULL) return;
+    dazzle_allocator_t alloc = text->font.alloc;
+    if(text->pixels != NULL) alloc.free(text->pixels);
+    if(text->text != NULL) alloc.free(text->text);
+    font_release(&text->font);
+    alloc.free(text);
+}
+
+#endif // __DT_TEXT_H__
@@ -0,0 +1,871 @@
+#ifndef __DT_TTF_H__
+#define __DT_TTF_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <dazzle.h>
+
+//======== File Format Definitions ========//
+
+#define TTF_MAGIC 0x00010000
+#define TTF_MAGIC_TRUE 0x74727565 //'true', older Apple fonts
+
+#define TTF_TAG(a, b, c, d) ((uint32_t)(a) << 24 | (uint32_t)(b) << 16 | (uint32_t)(c) << 8 | (uint32_t)(d))
+
+//Simple glyph point flags
+#define TTF_ON_CURVE 0x01
+#define TTF_X_SHORT 0x02
+#define TTF_Y_SHORT 0x04
+#define TTF_REPEAT 0x08
+#define TTF_X_SAME 0x10
+#define TTF_Y_SAME 0x20
+
+//Composite glyph component flags
+#define TTF_ARG_WORDS 0x0001
+#define TTF_ARGS_XY 0x0002
+#define TTF_HAVE_SCALE 0x0008
+#define TTF_MORE_COMPONENTS 0x0020
+#define TTF_XY_SCALE 0x0040
+#define TTF_TWO_BY_TWO 0x0080
+
+//======== Defines ========//
+
+#define TTF_MAX_COMPONENT_DEPTH 8
+#define TTF_MAX_POINTS 65536
+
+//======== Structure Definitions ========//
+
+typedef struct {
+    float x;
+    float y;
+    bool on_curve;
+} ttf_point_t;
+
+//A glyph's contours in font units, composites already flattened into one
+typedef struct {
+    uint32_t point_count;
+    uint32_t contour_count;
+    float x_min, y_min, x_max, y_max;
+    ttf_point_t* points;
+    uint32_t* contour_ends; //index of each contour's last point
+} ttf_outline_t;
+
+//8-bit coverage of one glyph at one pixel size
+typedef struct {
+    uint32_t glyph;
+    uint32_t size;
+    uint32_t width;
+    uint32_t height;
+    int32_t left;     //from the pen position to the bitmap's left edge
+    int32_t top;      //from the baseline to the bitmap's top edge, negative is up
+    uint32_t advance; //pen movement to the next glyph, in pixels
+    uint8_t* alpha;   //width * height, 0 is empty and 255 fully covered
+} ttf_bitmap_t;
+
+typedef struct {
+    uint32_t range;
+    uint32_t next;
+} ttf_cmap_iter_t;
+
+typedef struct {
+    dazzle_allocator_t alloc;
+    const uint8_t* data; //the whole file, owned by the caller
+    size_t size;
+
+    uint32_t glyph_count;
+    uint32_t units_per_em;
+    int32_t ascender;
+    int32_t descender;
+    int32_t line_gap;
+    uint32_t advance_max;
+    bool loca_long;
+    uint32_t hmetric_count;
+
+    const uint8_t* glyf; size_t glyf_size;
+    const uint8_t* loca; size_t loca_size;
+    const uint8_t* hmtx; size_t hmtx_size;
+    const uint8_t* cmap; size_t cmap_size; //the chosen subtable
+    uint32_t cmap_format;
+
+    //Caches, behind lock so fonts can be shared between threads. Entries
+    //are never evicted, so returned pointers live as long as the font.
+    pthread_mutex_t lock;
+    ttf_outline_t** outlines; //glyph_count entries, filled on first use
+    ttf_bitmap_t** bitmaps;   //open addressing on (glyph, size)
+    uint32_t bitmap_mask;
+    uint32_t bitmap_count;
+} ttf_font_t;
+
+//======== Reading ========//
+
+static inline uint16_t __ttf_u16(const uint8_t* p){ return (uint16_t)(p[0] << 8 | p[1]); }
+static inline int16_t __ttf_i16(const uint8_t* p){ return (int16_t)__ttf_u16(p); }
+static inline uint32_t __ttf_u32(const uint8_t* p){ return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3]; }
+
+//Finds a table, NULL if it's missing or runs past the file
+static const uint8_t* __ttf_table(const uint8_t* data, size_t size, uint32_t tag, size_t* length){
+    uint32_t count = __ttf_u16(data + 4);
+    if(12 + (size_t)count * 16 > size) return NULL;
+    for(uint32_t i = 0; i < count; i++){
+        const uint8_t* record = data + 12 + i * 16;
+        if(__ttf_u32(record) != tag) continue;
+        uint32_t offset = __ttf_u32(record + 8), len = __ttf_u32(record + 12);
+        if(offset > size || len > size - offset) return NULL;
+        *length = len;
+        return data + offset;
+    }
+    return NULL;
+}
+
+//Picks the best Unicode subtable: full range format 12 over BMP only format 4
+static bool __ttf_pick_cmap(ttf_font_t* ttf, const uint8_t* cmap, size_t size){
+    if(size < 4) return false;
+    uint32_t count = __ttf_u16(cmap + 2);
+    if(4 + (size_t)count * 8 > size) return false;
+
+    int best = 0;
+    for(uint32_t i = 0; i < count; i++){
+        const uint8_t* record = cmap + 4 + i * 8;
+        uint32_t platform = __ttf_u16(record), encoding = __ttf_u16(record + 2), offset = __ttf_u32(record + 4);
+        if(offset > size || size - offset < 8) continue;
+        const uint8_t* sub = cmap + offset;
+        uint32_t format = __ttf_u16(sub);
+        bool unicode = platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10));
+        if(!unicode || (format != 4 && format != 12)) continue;
+
+        size_t len = format == 4 ? __ttf_u16(sub + 2) : __ttf_u32(sub + 4);
+        if(len > size - offset || (format == 12 && len < 16) || (format == 4 && len < 14)) continue;
+        int score = format == 12 ? 2 : 1;
+        if(score <= best) continue;
+        best = score;
+        ttf->cmap = sub;
+        ttf->cmap_size = len;
+        ttf->cmap_format = format;
+    }
+    return best != 0;
+}
+
+//======== Functions ========//
+
+/*
+ * @brief Checks whether data starts like a TrueType font
+ *
+ * @param data The file
+ * @param size The size of the file
+ * @return bool True for TrueType magic numbers
+*/
+static inline bool ttf_is_font(const uint8_t* data, size_t size){
+    return size >= 12 && (__ttf_u32(data) == TTF_MAGIC || __ttf_u32(data) == TTF_MAGIC_TRUE);
+}
+
+/*
+ * @brief Parses the tables of a TrueType font, the data is used in place
+ *
+ * @param alloc The allocator for the font and its caches
+ * @param data The font file, which has to outlive the font
+ * @param size The size of the file
+ * @return ttf_font_t* The font, or NULL if it isn't a TrueType font with glyf outlines
+*/
+ttf_font_t* ttf_load(dazzle_allocator_t alloc, const uint8_t* data, size_t size){
+    if(data == NULL || !ttf_is_font(data, size)) return NULL;
+
+    size_t head_size, maxp_size, hhea_size, cmap_size;
+    const uint8_t* head = __ttf_table(data, size, TTF_TAG('h','e','a','d'), &head_size);
+    const uint8_t* maxp = __ttf_table(data, size, TTF_TAG('m','a','x','p'), &maxp_size);
+    const uint8_t* hhea = __ttf_table(data, size, TTF_TAG('h','h','e','a'), &hhea_size);
+    const uint8_t* cmap = __ttf_table(data, size, TTF_TAG('c','m','a','p'), &cmap_size);
+    if(head == NULL || head_size < 54 || maxp == NULL || maxp_size < 6 || hhea == NULL || hhea_size < 36 || cmap == NULL) return NULL;
+
+    ttf_font_t* ttf = alloc.malloc(sizeof(ttf_font_t));
+    if(ttf == NULL) return NULL;
+    memset(ttf, 0, sizeof(ttf_font_t));
+    ttf->alloc = alloc;
+    ttf->data = data;
+    ttf->size = size;
+
+    ttf->units_per_em = __ttf_u16(head + 18);
+    ttf->loca_long = __ttf_i16(head + 50) != 0;
+    ttf->glyph_count = __ttf_u16(maxp + 4);
+    ttf->ascender = __ttf_i16(hhea + 4);
+    ttf->descender = __ttf_i16(hhea + 6);
+    ttf->line_gap = __ttf_i16(hhea + 8);
+    ttf->advance_max = __ttf_u16(hhea + 10);
+    ttf->hmetric_count = __ttf_u16(hhea + 34);
+
+    ttf->glyf = __ttf_table(data, size, TTF_TAG('g','l','y','f'), &ttf->glyf_size);
+    ttf->loca = __ttf_table(data, size, TTF_TAG('l','o','c','a'), &ttf->loca_size);
+    ttf->hmtx = __ttf_table(data, size, TTF_TAG('h','m','t','x'), &ttf->hmtx_size);
+
+    bool valid = ttf->units_per_em != 0 && ttf->glyph_count != 0 && ttf->glyf != NULL && ttf->loca != NULL && ttf->hmtx != NULL &&
+                 ttf->loca_size >= ((size_t)ttf->glyph_count + 1) * (ttf->loca_long ? 4 : 2) &&
+                 ttf->hmetric_count != 0 && ttf->hmtx_size >= (size_t)ttf->hmetric_count * 4 &&
+                 __ttf_pick_cmap(ttf, cmap, cmap_size);
+    if(valid){
+        ttf->outlines = alloc.malloc(ttf->glyph_count * sizeof(ttf_outline_t*));
+        ttf->bitmap_mask = 255;
+        ttf->bitmaps = alloc.malloc((ttf->bitmap_mask + 1) * sizeof(ttf_bitmap_t*));
+    }
+    if(!valid || ttf->outlines == NULL || ttf->bitmaps == NULL){
+        if(ttf->outlines) alloc.free(ttf->outlines);
+        if(ttf->bitmaps) alloc.free(ttf->bitmaps);
+        alloc.free(ttf);
+        return NULL;
+    }
+    memset(ttf->outlines, 0, ttf->glyph_count * sizeof(ttf_outline_t*));
+    memset(ttf->bitmaps, 0, (ttf->bitmap_mask + 1) * sizeof(ttf_bitmap_t*));
+    pthread_mutex_init(&ttf->lock, NULL);
+    return ttf;
+}
+
+/*
+ * @brief Frees a font and everything it cached, the file data is left alone
+ *
+ * @param ttf The font to free
+*/
+void ttf_free(ttf_font_t* ttf){
+    if(ttf == NULL) return;
+    for(uint32_t i = 0; i < ttf->glyph_count; i++)
+        if(ttf->outlines[i] != NULL) ttf->alloc.free(ttf->outlines[i]);
+    for(uint32_t i = 0; i <= ttf->bitmap_mask; i++)
+        if(ttf->bitmaps[i] != NULL) ttf->alloc.free(ttf->bitmaps[i]);
+    ttf->alloc.free(ttf->outlines);
+    ttf->alloc.free(ttf->bitmaps);
+    pthread_mutex_destroy(&ttf->lock);
+    ttf->alloc.free(ttf);
+}
+
+/*
+ * @brief Maps a codepoint through the font's cmap
+ *
+ * @param ttf The font
+ * @param c The codepoint
+ * @return uint32_t The glyph, 0 (.notdef) if the font has none
+*/
+uint32_t ttf_lookup(const ttf_font_t* ttf, uint32_t c){
+    const uint8_t* sub = ttf->cmap;
+    uint32_t glyph = 0;
+
+    if(ttf->cmap_format == 12){
+        uint32_t groups = __ttf_u32(sub + 12);
+        if(groups > (ttf->cmap_size - 16) / 12) groups = (uint32_t)((ttf->cmap_size - 16) / 12);
+        uint32_t lo = 0, hi = groups;
+        while(lo < hi){
+            uint32_t mid = (lo + hi) / 2;
+            const uint8_t* group = sub + 16 + mid * 12;
+            if(c > __ttf_u32(group + 4)) lo = mid + 1;
+            else if(c < __ttf_u32(group)) hi = mid;
+            else {
+                glyph = __ttf_u32(group + 8) + (c - __ttf_u32(group));
+                break;
+            }
+        }
+    } else if(c <= 0xFFFF){
+        uint32_t segments = __ttf_u16(sub + 6) / 2;
+        if(16 + (size_t)segments * 8 > ttf->cmap_size) return 0;
+        const uint8_t* ends = sub + 14;
+        const uint8_t* starts = ends + segments * 2 + 2;
+        const uint8_t* deltas = starts + segments * 2;
+        const uint8_t* ranges = deltas + segments * 2;
+
+        uint32_t lo = 0, hi = segments;
+        while(lo < hi){
+            uint32_t mid = (lo + hi) / 2;
+            if(__ttf_u16(ends + mid * 2) < c) lo = mid + 1; else hi = mid;
+        }
+        if(lo == segments || __ttf_u16(starts + lo * 2) > c) return 0;
+
+        uint32_t range = __ttf_u16(ranges + lo * 2);
+        if(range == 0){
+            glyph = (c + __ttf_u16(deltas + lo * 2)) & 0xFFFF;
+        } else {
+            size_t at = (size_t)(ranges + lo * 2 - sub) + range + (c - __ttf_u16(starts + lo * 2)) * 2;
+            if(at + 2 > ttf->cmap_size) return 0;
+            glyph = __ttf_u16(sub + at);
+            if(glyph != 0) glyph = (glyph + __ttf_u16(deltas + lo * 2)) & 0xFFFF;
+        }
+    }
+    return glyph < ttf->glyph_count ? glyph : 0;
+}
+
+/*
+ * @brief Walks every mapping of the cmap, by range and then codepoint
+ *
+ * @param ttf The font
+ * @param it Iteration state, zeroed before the first call
+ * @param c Set to the next mapped codepoint
+ * @param glyph Set to its glyph
+ * @return bool False once every mapping was visited
+*/
+bool ttf_cmap_next(const ttf_font_t* ttf, ttf_cmap_iter_t* it, uint32_t* c, uint32_t* glyph){
+    const uint8_t* sub = ttf->cmap;
+    uint32_t count;
+    if(ttf->cmap_format == 12){
+        count = __ttf_u32(sub + 12);
+        if(count > (ttf->cmap_size - 16) / 12) count = (uint32_t)((ttf->cmap_size - 16) / 12);
+    } else {
+        count = __ttf_u16(sub + 6) / 2;
+        if(16 + (size_t)count * 8 > ttf->cmap_size) return false;
+    }
+
+    for(; it->range < count; it->range++){
+        uint32_t start, end;
+        if(ttf->cmap_format == 12){
+            start = __ttf_u32(sub + 16 + it->range * 12);
+            end = __ttf_u32(sub + 16 + it->range * 12 + 4);
+        } else {
+            end = __ttf_u16(sub + 14 + it->range * 2);
+            start = __ttf_u16(sub + 16 + count * 2 + it->range * 2);
+        }
+        if(end > 0x10FFFF) end = 0x10FFFF;
+        if(it->next < start) it->next = start;
+        while(it->next <= end){
+            uint32_t cp = it->next++;
+            uint32_t g = ttf_lookup(ttf, cp);
+            if(g != 0){
+                *c = cp;
+                *glyph = g;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/*
+ * @brief Horizontal metrics of a glyph in font units
+ *
+ * @param ttf The font
+ * @param glyph The glyph
+ * @return uint32_t Its advance width
+*/
+uint32_t ttf_advance(const ttf_font_t* ttf, uint32_t glyph){
+    //Glyphs past the long metrics repeat the last advance
+    if(glyph >= ttf->hmetric_count) glyph = ttf->hmetric_count - 1;
+    return __ttf_u16(ttf->hmtx + glyph * 4);
+}
+
+//======== Outlines ========//
+
+typedef struct {
+    dazzle_allocator_t alloc;
+    ttf_point_t* points;
+    uint32_t* ends;
+    uint32_t point_count, point_capacity;
+    uint32_t contour_count, contour_capacity;
+    bool failed;
+} __ttf_builder_t;
+
+static bool __ttf_grow(__ttf_builder_t* b, uint32_t points, uint32_t contours){
+    if(b->failed) return false;
+    if(b->point_count + points > TTF_MAX_POINTS){
+        b->failed = true;
+        return false;
+    }
+    if(b->point_count + points > b->point_capacity){
+        uint32_t capacity = b->point_capacity ? b->point_capacity : 64;
+        while(capacity < b->point_count + points) capacity *= 2;
+        ttf_point_t* grown = b->alloc.malloc(capacity * sizeof(ttf_point_t));
+        if(grown == NULL) return b->failed = true, false;
+        if(b->points){
+            memcpy(grown, b->points, b->point_count * sizeof(ttf_point_t));
+            b->alloc.free(b->points);
+        }
+        b->points = grown;
+        b->point_capacity = capacity;
+    }
+    if(b->contour_count + contours > b->contour_capacity){
+        uint32_t capacity = b->contour_capacity ? b->contour_capacity : 8;
+        while(capacity < b->contour_count + contours) capacity *= 2;
+        uint32_t* grown = b->alloc.malloc(capacity * sizeof(uint32_t));
+        if(grown == NULL) return b->failed = true, false;
+        if(b->ends){
+            memcpy(grown, b->ends, b->contour_count * sizeof(uint32_t));
+            b->alloc.free(b->ends);
+        }
+        b->ends = grown;
+        b->contour_capacity = capacity;
+    }
+    return true;
+}
+
+//Where a glyph's data lives in glyf, false for empty glyphs and broken offsets
+static bool __ttf_glyph_data(const ttf_font_t* ttf, uint32_t glyph, const uint8_t** data, size_t* size){
+    size_t start, end;
+    if(ttf->loca_long){
+        start = __ttf_u32(ttf->loca + glyph * 4);
+        end = __ttf_u32(ttf->loca + glyph * 4 + 4);
+    } else {
+        start = (size_t)__ttf_u16(ttf->loca + glyph * 2) * 2;
+        end = (size_t)__ttf_u16(ttf->loca + glyph * 2 + 2) * 2;
+    }
+    if(end <= start || end > ttf->glyf_size || end - start < 10) return false;
+    *data = ttf->glyf + start;
+    *size = end - start;
+    return true;
+}
+
+//Appends glyph's contours transformed by the 2x3 matrix m
+static void __ttf_load_glyph(const ttf_font_t* ttf, __ttf_builder_t* b, uint32_t glyph, const float m[6], uint32_t depth){
+    const uint8_t* g;
+    size_t size;
+    //Once the outline is too big, nested components would only multiply the work
+    if(b->failed || glyph >= ttf->glyph_count || !__ttf_glyph_data(ttf, glyph, &g, &size)) return;
+    const uint8_t* end = g + size;
+    int32_t contours = __ttf_i16(g);
+
+    if(contours < 0){
+        if(depth >= TTF_MAX_COMPONENT_DEPTH) return;
+        const uint8_t* p = g + 10;
+        uint32_t flags;
+        do {
+            if(end - p < 6) return;
+            flags = __ttf_u16(p);
+            uint32_t component = __ttf_u16(p + 2);
+            p += 4;
+            float dx, dy;
+            if(flags & TTF_ARG_WORDS){
+                if(end - p < 4) return;
+                dx = __ttf_i16(p);
+                dy = __ttf_i16(p + 2);
+                p += 4;
+            } else {
+                dx = (int8_t)p[0];
+                dy = (int8_t)p[1];
+                p += 2;
+            }
+            //Matching points instead of offsets is rare, those components stay in place
+            if(!(flags & TTF_ARGS_XY)) dx = dy = 0;
+
+            float a = 1, bb = 0, c = 0, d = 1;
+            if(flags & TTF_HAVE_SCALE){
+                if(end - p < 2) return;
+                a = d = __ttf_i16(p) / 16384.0f;
+                p += 2;
+            } else if(flags & TTF_XY_SCALE){
+                if(end - p < 4) return;
+                a = __ttf_i16(p) / 16384.0f;
+                d = __ttf_i16(p + 2) / 16384.0f;
+                p += 4;
+            } else if(flags & TTF_TWO_BY_TWO){
+                if(end - p < 8) return;
+                a = __ttf_i16(p) / 16384.0f;
+                bb = __ttf_i16(p + 2) / 16384.0f;
+                c = __ttf_i16(p + 4) / 16384.0f;
+                d = __ttf_i16(p + 6) / 16384.0f;
+                p += 8;
+            }
+
+            //Component space to glyph space, then through m
+            float local[6] = {
+                m[0] * a + m[2] * bb, m[1] * a + m[3] * bb,
+                m[0] * c + m[2] * d, m[1] * c + m[3] * d,
+                m[0] * dx + m[2] * dy + m[4], m[1] * dx + m[3] * dy + m[5]
+            };
+            __ttf_load_glyph(ttf, b, component, local, depth + 1);
+        } while((flags & TTF_MORE_COMPONENTS) && !b->failed);
+        return;
+    }
+
+    if(contours == 0 || 12 + (size_t)contours * 2 > size) return;
+    uint32_t count = __ttf_u16(g + 10 + (contours - 1) * 2) + 1;
+    const uint8_t* p = g + 10 + contours * 2;
+    p += 2 + __ttf_u16(p);
+    if(p > end || !__ttf_grow(b, count, (uint32_t)contours)) return;
+
+    //Flags first, then every x, then every y, each with its own encoding
+    ttf_point_t* out = b->points + b->point_count;
+    uint8_t flags = 0, repeat = 0;
+    for(uint32_t i = 0; i < count; i++){
+        if(repeat == 0){
+            if(p >= end) return;
+            flags = *p++;
+            if(flags & TTF_REPEAT){
+                if(p >= end) return;
+                repeat = *p++;
+            }
+        } else {
+            repeat--;
+        }
+        out[i].on_curve = flags & TTF_ON_CURVE;
+        out[i].x = flags; //parked here until the coordinates are read
+    }
+    int32_t value = 0;
+    for(uint32_t i = 0; i < count; i++){
+        uint8_t f = (uint8_t)out[i].x;
+        if(f & TTF_X_SHORT){
+            if(p >= end) return;
+            value += f & TTF_X_SAME ? *p : -(int32_t)*p;
+            p++;
+        } else if(!(f & TTF_X_SAME)){
+            if(end - p < 2) return;
+            value += __ttf_i16(p);
+            p += 2;
+        }
+        out[i].y = f;
+        out[i].x = (float)value;
+    }
+    value = 0;
+    for(uint32_t i = 0; i < count; i++){
+        uint8_t f = (uint8_t)out[i].y;
+        if(f & TTF_Y_SHORT){
+            if(p >= end) return;
+            value += f & TTF_Y_SAME ? *p : -(int32_t)*p;
+            p++;
+        } else if(!(f & TTF_Y_SAME)){
+            if(end - p < 2) return;
+            value += __ttf_i16(p);
+            p += 2;
+        }
+        float x = out[i].x, y = (float)value;
+        out[i].x = m[0] * x + m[2] * y + m[4];
+        out[i].y = m[1] * x + m[3] * y + m[5];
+    }
+
+    //Contour ends have to increase and stay inside the points
+    uint32_t last = 0;
+    for(int32_t i = 0; i < contours; i++){
+        uint32_t e = __ttf_u16(g + 10 + i * 2);
+        if(e >= count || (i > 0 && e <= last)) return;
+        last = e;
+    }
+    for(int32_t i = 0; i < contours; i++)
+        b->ends[b->contour_count + i] = b->point_count + __ttf_u16(g + 10 + i * 2);
+    b->point_count += count;
+    b->contour_count += (uint32_t)contours;
+}
+
+//The glyph's outline from the cache, parsed on first use. Never NULL for valid glyphs.
+static ttf_outline_t* __ttf_outline(ttf_font_t* ttf, uint32_t glyph){
+    pthread_mutex_lock(&ttf->lock);
+    ttf_outline_t* cached = ttf->outlines[glyph];
+    pthread_mutex_unlock(&ttf->lock);
+    if(cached != NULL) return cached;
+
+    __ttf_builder_t b;
+    memset(&b, 0, sizeof(b));
+    b.alloc = ttf->alloc;
+    static const float identity[6] = {1, 0, 0, 1, 0, 0};
+    __ttf_load_glyph(ttf, &b, glyph, identity, 0);
+
+    //One allocation for the outline, its points and its contour ends
+    size_t size = sizeof(ttf_outline_t) + (size_t)b.point_count * sizeof(ttf_point_t) + (size_t)b.contour_count * sizeof(uint32_t);
+    ttf_outline_t* outline = b.failed ? NULL : ttf->alloc.malloc(size);
+    if(outline != NULL){
+        memset(outline, 0, sizeof(ttf_outline_t));
+        outline->point_count = b.point_count;
+        outline->contour_count = b.contour_count;
+        outline->points = (ttf_point_t*)(outline + 1);
+        outline->contour_ends = (uint32_t*)(outline->points + b.point_count);
+        if(b.point_count) memcpy(outline->points, b.points, b.point_count * sizeof(ttf_point_t));
+        if(b.contour_count) memcpy(outline->contour_ends, b.ends, b.contour_count * sizeof(uint32_t));
+
+        //Control points bound the curves, so their box bounds the glyph
+        for(uint32_t i = 0; i < b.point_count; i++){
+            ttf_point_t* pt = &outline->points[i];
+            if(i == 0 || pt->x < outline->x_min) outline->x_min = pt->x;
+            if(i == 0 || pt->x > outline->x_max) outline->x_max = pt->x;
+            if(i == 0 || pt->y < outline->y_min) outline->y_min = pt->y;
+            if(i == 0 || pt->y > outline->y_max) outline->y_max = pt->y;
+        }
+    }
+    if(b.points) ttf->alloc.free(b.points);
+    if(b.ends) ttf->alloc.free(b.ends);
+    if(outline == NULL) return NULL;
+
+    pthread_mutex_lock(&ttf->lock);
+    if(ttf->outlines[glyph] == NULL){
+        ttf->outlines[glyph] = outline;
+    } else {
+        ttf->alloc.free(outline);
+        outline = ttf->outlines[glyph];
+    }
+    pthread_mutex_unlock(&ttf->lock);
+    return outline;
+}
+
+//======== Rasterizer ========//
+// Signed area coverage accumulation: every edge adds the area it covers to
+// the cells it crosses and the rest of its height to the cell after. A running
+// sum over the buffer then gives each pixel's coverage, exact for polygons.
+
+typedef struct {
+    float* acc;
+    uint32_t width;
+    uint32_t height;
+} __ttf_raster_t;
+
+static void __ttf_line(__ttf_raster_t* r, float x0, float y0, float x1, float y1){
+    if(y0 == y1) return;
+    float dir = 1;
+    if(y0 > y1){
+        float t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+        dir = -1;
+    }
+    float dxdy = (x1 - x0) / (y1 - y0);
+    float x = x0;
+    if(y0 < 0){
+        x -= y0 * dxdy;
+        y0 = 0;
+    }
+    uint32_t y_end = y1 > r->height ? r->height : (uint32_t)ceilf(y1);
+    float w = (float)r->width;
+
+    for(uint32_t y = (uint32_t)y0; y < y_end; y++){
+        float* row = r->acc + (size_t)y * r->width;
+        float dy = ((float)(y + 1) < y1 ? (float)(y + 1) : y1) - ((float)y > y0 ? (float)y : y0);
+        float xnext = x + dxdy * dy;
+        float d = dy * dir;
+        float xa = x < xnext ? x : xnext, xb = x < xnext ? xnext : x;
+        if(xa < 0) xa = 0;
+        if(xb > w) xb = w;
+        if(xa > w) xa = w;
+        float xa_floor = floorf(xa);
+        uint32_t xai = (uint32_t)xa_floor, xbi = (uint32_t)ceilf(xb);
+
+        if(xbi <= xai + 1){
+            //Stays within one cell, split by the mean x
+            float xmf = 0.5f * (x + xnext) - xa_floor;
+            if(xmf < 0) xmf = 0;
+            if(xmf > 1) xmf = 1;
+            row[xai] += d - d * xmf;
+            row[xai + 1] += d * xmf;
+        } else {
+            float s = 1.0f / (xb - xa);
+            float xaf = xa - xa_floor;
+            float a0 = 0.5f * s * (1 - xaf) * (1 - xaf);
+            float xbf = xb - (float)xbi + 1;
+            float am = 0.5f * s * xbf * xbf;
+            row[xai] += d * a0;
+            if(xbi == xai + 2){
+                row[xai + 1] += d * (1 - a0 - am);
+            } else {
+                float a1 = s * (1.5f - xaf);
+                row[xai + 1] += d * (a1 - a0);
+                for(uint32_t xi = xai + 2; xi < xbi - 1; xi++)
+                    row[xi] += d * s;
+                float a2 = a1 + (float)(xbi - xai - 3) * s;
+                row[xbi - 1] += d * (1 - a2 - am);
+            }
+            row[xbi] += d * am;
+        }
+        x = xnext;
+    }
+}
+
+//Flattens a quadratic curve into lines, finer where it bends more
+static void __ttf_quad(__ttf_raster_t* r, float x0, float y0, float cx, float cy, float x1, float y1){
+    float ddx = x0 - 2 * cx + x1, ddy = y0 - 2 * cy + y1;
+    //The curve strays dd / (8 n^2) from n chords, keep that under a fifth of a pixel
+    uint32_t n = 1 + (uint32_t)sqrtf(sqrtf(ddx * ddx + ddy * ddy) * 0.625f);
+    if(n > 32) n = 32;
+    float px = x0, py = y0;
+    for(uint32_t i = 1; i <= n; i++){
+        float t = (float)i / n, mt = 1 - t;
+        float qx = mt * mt * x0 + 2 * mt * t * cx + t * t * x1;
+        float qy = mt * mt * y0 + 2 * mt * t * cy + t * t * y1;
+        __ttf_line(r, px, py, qx, qy);
+        px = qx;
+        py = qy;
+    }
+}
+
+//Draws every contour, filling in the on-curve points implied between two off-curve ones
+static void __ttf_fill_outline(__ttf_raster_t* r, const ttf_outline_t* o, float scale, float ox, float oy){
+    uint32_t first = 0;
+    for(uint32_t c = 0; c < o->contour_count; first = o->contour_ends[c++] + 1){
+        uint32_t last = o->contour_ends[c], n = last - first + 1;
+        if(n < 2) continue;
+        #define __TTF_X(i) (o->points[first + (i)].x * scale - ox)
+        #define __TTF_Y(i) (oy - o->points[first + (i)].y * scale)
+
+        float sx, sy;
+        uint32_t from, to;
+        if(o->points[first].on_curve){
+            sx = __TTF_X(0); sy = __TTF_Y(0); from = 1; to = n;
+        } else if(o->points[last].on_curve){
+            sx = __TTF_X(n - 1); sy = __TTF_Y(n - 1); from = 0; to = n - 1;
+        } else {
+            sx = (__TTF_X(0) + __TTF_X(n - 1)) / 2; sy = (__TTF_Y(0) + __TTF_Y(n - 1)) / 2; from = 0; to = n;
+        }
+
+        float x = sx, y = sy, cx = 0, cy = 0;
+        bool control = false;
+        for(uint32_t i = from; i < to; i++){
+            float px = __TTF_X(i), py = __TTF_Y(i);
+            if(o->points[first + i].on_curve){
+                if(control) __ttf_quad(r, x, y, cx, cy, px, py); else __ttf_line(r, x, y, px, py);
+                x = px; y = py;
+                control = false;
+            } else {
+                if(control){
+                    float mx = (cx + px) / 2, my = (cy + py) / 2;
+                    __ttf_quad(r, x, y, cx, cy, mx, my);
+                    x = mx; y = my;
+                }
+                cx = px; cy = py;
+                control = true;
+            }
+        }
+        if(control) __ttf_quad(r, x, y, cx, cy, sx, sy); else __ttf_line(r, x, y, sx, sy);
+        #undef __TTF_X
+        #undef __TTF_Y
+    }
+}
+
+//Running sum of the signed areas into 8-bit coverage, four lanes at a time with SSE2
+static void __ttf_accumulate(const float* acc, uint8_t* out, size_t n){
+    size_t i = 0;
+    float sum = 0;
+#ifdef DAZZLE_SIMD_SSE2
+    __m128 offset = _mm_setzero_ps();
+    const __m128 sign = _mm_set1_ps(-0.0f), one = _mm_set1_ps(1.0f), full = _mm_set1_ps(255.0f), half = _mm_set1_ps(0.5f);
+    for(; i + 4 <= n; i += 4){
+        __m128 x = _mm_loadu_ps(acc + i);
+        x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)));
+        x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 8)));
+        x = _mm_add_ps(x, offset);
+        __m128 y = _mm_min_ps(_mm_andnot_ps(sign, x), one);
+        __m128i v = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(y, full), half));
+        v = _mm_packs_epi32(v, v);
+        v = _mm_packus_epi16(v, v);
+        uint32_t bytes = (uint32_t)_mm_cvtsi128_si32(v);
+        memcpy(out + i, &bytes, 4);
+        offset = _mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+    sum = _mm_cvtss_f32(offset);
+#endif
+    for(; i < n; i++){
+        sum += acc[i];
+        float y = fabsf(sum);
+        out[i] = (uint8_t)((y < 1 ? y : 1) * 255.0f + 0.5f);
+    }
+}
+
+//======== Cache ========//
+
+static inline uint32_t __ttf_bitmap_hash(uint32_t glyph, uint32_t size){
+    uint32_t h = glyph * 0x9E3779B1u ^ size * 0x85EBCA77u;
+    return h ^ (h >> 15);
+}
+
+//Looks up (glyph, size), the lock has to be held
+static ttf_bitmap_t* __ttf_bitmap_find(ttf_font_t* ttf, uint32_t glyph, uint32_t size){
+    for(uint32_t i = __ttf_bitmap_hash(glyph, size) & ttf->bitmap_mask;; i = (i + 1) & ttf->bitmap_mask){
+        ttf_bitmap_t* b = ttf->bitmaps[i];
+        if(b == NULL || (b->glyph == glyph && b->size == size)) return b;
+    }
+}
+
+//Adds a bitmap, growing the table at half load. The lock has to be held.
+static bool __ttf_bitmap_insert(ttf_font_t* ttf, ttf_bitmap_t* bitmap){
+    if((ttf->bitmap_count + 1) * 2 > ttf->bitmap_mask + 1){
+        uint32_t mask = ttf->bitmap_mask * 2 + 1;
+        ttf_bitmap_t** grown = ttf->alloc.malloc((mask + 1) * sizeof(ttf_bitmap_t*));
+        if(grown == NULL) return false;
+        memset(grown, 0, (mask + 1) * sizeof(ttf_bitmap_t*));
+        for(uint32_t i = 0; i <= ttf->bitmap_mask; i++){
+            ttf_bitmap_t* b = ttf->bitmaps[i];
+            if(b == NULL) continue;
+            uint32_t j = __ttf_bitmap_hash(b->glyph, b->size) & mask;
+            while(grown[j] != NULL) j = (j + 1) & mask;
+            grown[j] = b;
+        }
+        ttf->alloc.free(ttf->bitmaps);
+        ttf->bitmaps = grown;
+        ttf->bitmap_mask = mask;
+    }
+    uint32_t i = __ttf_bitmap_hash(bitmap->glyph, bitmap->size) & ttf->bitmap_mask;
+    while(ttf->bitmaps[i] != NULL) i = (i + 1) & ttf->bitmap_mask;
+    ttf->bitmaps[i] = bitmap;
+    ttf->bitmap_count++;
+    return true;
+}
+
+/*
+ * @brief Rasterizes a glyph, or returns it from the cache when it was done before
+ *
+ * @param ttf The font
+ * @param glyph The glyph index, see ttf_lookup
+ * @param size The size in pixels per em
+ * @return const ttf_bitmap_t* Coverage and placement, valid until the font is freed, NULL on failure
+*/
+const ttf_bitmap_t* ttf_render(ttf_font_t* ttf, uint32_t glyph, uint32_t size){
+    if(glyph >= ttf->glyph_count || size == 0) return NULL;
+
+    pthread_mutex_lock(&ttf->lock);
+    ttf_bitmap_t* cached = __ttf_bitmap_find(ttf, glyph, size);
+    pthread_mutex_unlock(&ttf->lock);
+    if(cached != NULL) return cached;
+
+    DAZZLE_TRACE_SCOPE("ttf_rasterize");
+    ttf_outline_t* outline = __ttf_outline(ttf, glyph);
+    if(outline == NULL) return NULL;
+
+    float scale = (float)size / ttf->units_per_em;
+    int32_t left = 0, top = 0;
+    uint32_t width = 0, height = 0;
+    if(outline->point_count != 0){
+        left = (int32_t)floorf(outline->x_min * scale);
+        top = (int32_t)floorf(-outline->y_max * scale);
+        width = (uint32_t)((int32_t)ceilf(outline->x_max * scale) - left);
+        height = (uint32_t)((int32_t)ceilf(-outline->y_min * scale) - top);
+        if(width > 4 * size + 64 || height > 4 * size + 64) width = height = 0; //broken bounds
+    }
+
+    ttf_bitmap_t* bitmap = ttf->alloc.malloc(sizeof(ttf_bitmap_t) + (size_t)width * height);
+    if(bitmap == NULL) return NULL;
+    bitmap->glyph = glyph;
+    bitmap->size = size;
+    bitmap->width = width;
+    bitmap->height = height;
+    bitmap->left = left;
+    bitmap->top = top;
+    bitmap->advance = (uint32_t)(ttf_advance(ttf, glyph) * scale + 0.5f);
+    bitmap->alpha = (uint8_t*)(bitmap + 1);
+
+    if(width != 0 && height != 0){
+        //Spare cells, edges on the right border spill past the last row
+        size_t cells = (size_t)width * height + 4;
+        float* acc = ttf->alloc.malloc(cells * sizeof(float));
+        if(acc == NULL){
+            ttf->alloc.free(bitmap);
+            return NULL;
+        }
+        memset(acc, 0, cells * sizeof(float));
+        __ttf_raster_t r = {acc, width, height};
+        __ttf_fill_outline(&r, outline, scale, (float)left, (float)-top);
+        __ttf_accumulate(acc, bitmap->alpha, (size_t)width * height);
+        ttf->alloc.free(acc);
+    }
+
+    pthread_mutex_lock(&ttf->lock);
+    cached = __ttf_bitmap_find(ttf, glyph, size);
+    if(cached == NULL && __ttf_bitmap_insert(ttf, bitmap)){
+        cached = bitmap;
+        bitmap = NULL;
+    }
+    pthread_mutex_unlock(&ttf->lock);
+    if(bitmap != NULL) ttf->alloc.free(bitmap);
+    return cached;
+}
+
+/*
+ * @brief Line metrics at a size, in pixels
+ *
+ * @param ttf The font
+ * @param size The size in pixels per em
+ * @param ascent Set to the distance from the top of a line to the baseline
+ * @param line_height Set to the distance between two baselines
+*/
+void ttf_line_metrics(const ttf_font_t* ttf, uint32_t size, uint32_t* ascent, uint32_t* line_height){
+    float scale = (float)size / ttf->units_per_em;
+    *ascent = (uint32_t)ceilf(ttf->ascender * scale);
+    *line_height = (uint32_t)ceilf((ttf->ascender - ttf->descender + ttf->line_gap) * scale);
+}
+
+#endif // __DT_TTF_H__
@@ -0,0 +1,400 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define __DAZZLE_IMPL__
+#include <bt.h>
+#include <dt_glyphs.h>
+#include <dt_cache.h>
+#include <dt_text.h>
+
+// Headless benchmark of the dazzle primitives against the memory backend.
+// Prints one JSON object per line:
+//   {"bench":"...","width":W,"height":H,"format":"...","unit":"...","value":V}
+// Usage: ./bench [font.psf] [seconds per measurement] [font.ttf]
+
+#define ELEMENTS 256
+
+typedef struct {
+    const char* name;
+    dazzle_framebuffer_t fb;
+} format_t;
+
+static double min_seconds = 0.2;
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void report(const char* bench, dazzle_framebuffer_t* fb, const char* format, const char* unit, double value) {
+    printf("{\"bench\":\"%s\",\"width\":%u,\"height\":%u,\"format\":\"%s\",\"unit\":\"%s\",\"value\":%.3f}\n",
+           bench, fb->width, fb->height, format, unit, value);
+    fflush(stdout);
+}
+
+// Runs fn until min_seconds passed, returns seconds per call
+typedef void (*bench_fn)(dazzle_context_t* ctx, void* arg);
+
+static double measure(bench_fn fn, dazzle_context_t* ctx, void* arg) {
+    fn(ctx, arg); // warm caches and one-time translations
+
+    uint64_t iterations = 0;
+    double start = now(), elapsed;
+    do {
+        fn(ctx, arg);
+        iterations++;
+        elapsed = now() - start;
+    } while (elapsed < min_seconds || iterations < 3);
+
+    return elapsed / iterations;
+}
+
+//======== Workloads ========//
+
+typedef struct {
+    dazzle_retained_element_t* elements[ELEMENTS];
+    double pixels; // covered per pass, analytic for triangles and circles
+} element_set_t;
+
+static void draw_set(dazzle_context_t* ctx, void* arg) {
+    element_set_t* set = arg;
+    for (int i = 0; i < ELEMENTS; i++)
+        dazzle_draw(ctx, set->elements[i]);
+}
+
+static void clear_screen(dazzle_context_t* ctx, void* arg) {
+    (void)arg;
+    dazzle_clear(ctx, 0xFF302010);
+}
+
+static void redraw(dazzle_context_t* ctx, void* arg) {
+    (void)arg;
+    dazzle_redraw(ctx);
+}
+
+static uint32_t rnd(uint32_t max) {
+    return max == 0 ? 0 : (uint32_t)rand() % max;
+}
+
+static void build_set(dazzle_context_t* ctx, dazzle_framebuffer_t* fb, element_set_t* set, int kind, bool filled) {
+    uint32_t size = fb->height / 4;
+    set->pixels = 0;
+
+    for (int i = 0; i < ELEMENTS; i++) {
+        uint32_t color = 0xFF000000 | (uint32_t)rand();
+        uint32_t a = rnd(size) + 8, b = rnd(size) + 8;
+        uint32_t x = rnd(fb->width - a), y = rnd(fb->height - b);
+
+        if (kind == DAZZLE_RETAINED_RECTANGLE) {
+            set->elements[i] = dazzle_create_rectangle(ctx, x, y, a, b, filled, color);
+            set->pixels += filled ? (double)a * b : 2.0 * (a + b);
+        } else if (kind == DAZZLE_RETAINED_CIRCLE) {
+            uint32_t r = a / 2;
+            set->elements[i] = dazzle_create_circle(ctx, x + r, y + r, r, filled, color);
+            set->pixels += filled ? 3.14159265 * r * r : 2 * 3.14159265 * r;
+        } else {
+            uint32_t x3 = x + rnd(a), y3 = y + b;
+            set->elements[i] = dazzle_create_triangle(ctx, x, y, x + a, y, x3, y3, filled, color);
+            set->pixels += filled ? (double)a * b / 2 : a + 2.0 * (b > a ? b : a);
+        }
+    }
+}
+
+static void free_set(dazzle_context_t* ctx, element_set_t* set) {
+    for (int i = 0; i < ELEMENTS; i++)
+        ctx->alloc.free(set->elements[i]);
+}
+
+typedef struct {
+    font_t* font;
+    uint32_t glyphs;
+    glyph_cache_t* cache;
+    uint32_t scale;
+} glyph_args_t;
+
+// What a naive text renderer pays per character: rasterize, translate, blit
+static void glyph_render_blit(dazzle_context_t* ctx, void* arg) {
+    glyph_args_t* g = arg;
+    dazzle_framebuffer_t* fb = dazzle_memory_framebuffer(ctx);
+    uint32_t x = 0, y = 0;
+
+    for (uint32_t i = 0; i < g->glyphs; i++) {
+        glyph_t glyph = render_glyph(*g->font, 32 + i % 95, 0, 0xFFFFFFFF);
+        dazzle_retained_element_t* e = dazzle_create_blitable(ctx, x, y, glyph.width, glyph.height, glyph.buffer);
+        dazzle_draw(ctx, e);
+
+        if (e->type_data.blit.translated)
+            ctx->alloc.free(e->type_data.blit.buffer);
+        ctx->alloc.free(e);
+        g->font->alloc.free(glyph.buffer);
+
+        x += glyph.width;
+        if (x + glyph.width > fb->width) {
+            x = 0;
+            y = y + 2 * glyph.height > fb->height ? 0 : y + glyph.height;
+        }
+    }
+}
+
+// Straight from the font's bits into the target
+static void glyph_direct(dazzle_context_t* ctx, void* arg) {
+    glyph_args_t* g = arg;
+    dazzle_framebuffer_t* fb = dazzle_memory_framebuffer(ctx);
+    uint32_t x = 0, y = 0, w = g->font->suggested_width * g->scale, h = g->font->suggested_height * g->scale;
+
+    for (uint32_t i = 0; i < g->glyphs; i++) {
+        draw_glyph_scaled(ctx, *g->font, 32 + i % 95, x, y, g->scale, 0xFFFFFFFF, 0xFF000000);
+
+        x += w;
+        if (x + w > fb->width) {
+            x = 0;
+            y = y + 2 * h > fb->height ? 0 : y + h;
+        }
+    }
+}
+
+// The same text through the glyph atlas, a lookup and one copy per row once warm
+static void glyph_cached(dazzle_context_t* ctx, void* arg) {
+    glyph_args_t* g = arg;
+    dazzle_framebuffer_t* fb = dazzle_memory_framebuffer(ctx);
+    uint32_t x = 0, y = 0, w = g->font->suggested_width, h = g->font->suggested_height;
+
+    for (uint32_t i = 0; i < g->glyphs; i++) {
+        glyph_cache_draw(g->cache, ctx, g->font, 32 + i % 95, x, y, 1, 0xFFFFFFFF, 0);
+
+        x += w;
+        if (x + w > fb->width) {
+            x = 0;
+            y = y + 2 * h > fb->height ? 0 : y + h;
+        }
+    }
+}
+
+// Whole lines of UTF-8 at once, one composed bitmap and draw per line
+static void text_lines(dazzle_context_t* ctx, void* arg) {
+    glyph_args_t* g = arg;
+    dazzle_framebuffer_t* fb = dazzle_memory_framebuffer(ctx);
+    static const char line[] = "The quick brown fox jumps over the lazy dog. 0123456789 !\"#$%&'()*+,-./:;<=>?@[]^_{|}~";
+    uint32_t per_line = sizeof(line) - 1, y = 0, h = g->font->suggested_height;
+    if (per_line > fb->width / g->font->suggested_width)
+        per_line = fb->width / g->font->suggested_width; // only what is visible counts
+
+    for (uint32_t i = 0; i < g->glyphs; i += per_line) {
+        draw_text(ctx, *g->font, 0, y, line, per_line, 0xFFFFFFFF, 0xFF000000);
+        y = y + 2 * h > fb->height ? 0 : y + h;
+    }
+}
+
+//======== Text decoding ========//
+
+#define DECODE_BYTES (1 << 20)
+
+typedef struct {
+    uint8_t* data;
+    size_t len;
+    uint32_t* out;
+} decode_args_t;
+
+static void decode_bytewise(dazzle_context_t* ctx, void* arg) {
+    (void)ctx;
+    decode_args_t* d = arg;
+    utf8_dec_state_t state = {0, 0, 0};
+    size_t n = 0;
+    for (size_t i = 0; i < d->len; i++) {
+        uint32_t cp;
+        if (utf8_decode(&state, d->data[i], &cp) == UTF8_CODEPOINT_EXTRACTED)
+            d->out[n++] = cp;
+    }
+}
+
+static void decode_bulk(dazzle_context_t* ctx, void* arg) {
+    (void)ctx;
+    decode_args_t* d = arg;
+    utf8_dec_state_t state = {0, 0, 0};
+    utf8_decode_buf(&state, d->data, d->len, d->out, d->len, NULL);
+}
+
+// Fills the buffer with sample repeated, whole copies only
+static size_t fill_text(uint8_t* data, const char* sample) {
+    size_t len = strlen(sample), used = 0;
+    for (; used + len <= DECODE_BYTES; used += len)
+        memcpy(data + used, sample, len);
+    return used;
+}
+
+static void bench_decode(void) {
+    static const struct {
+        const char* name;
+        const char* sample;
+    } texts[] = {
+        {"ascii", "The quick brown fox jumps over the lazy dog. 0123456789 !\"#$%&'()*+,-./:;<=>?@[]^_{|}~\n"},
+        {"mixed", "ls -l \xd0\x9a\xd0\xb8\xd1\x80\xd0\xb8\xd0\xbb\xd0\xbb\xd0\xb8\xd1\x86\xd0\xb0 \xe2\x94\x8c\xe2\x94\x80\xe2\x94\x90 "
+                  "\xe6\xbc\xa2\xe5\xad\x97 \xf0\x9f\x98\x80 plain ascii between the rest of it\n"},
+    };
+    dazzle_framebuffer_t none = {0};
+    decode_args_t d = {malloc(DECODE_BYTES), 0, malloc(DECODE_BYTES * sizeof(uint32_t))};
+    if (d.data == NULL || d.out == NULL) {
+        free(d.data);
+        free(d.out);
+        return;
+    }
+
+    for (size_t i = 0; i < sizeof(texts) / sizeof(texts[0]); i++) {
+        char name[32];
+        d.len = fill_text(d.data, texts[i].sample);
+        snprintf(name, sizeof(name), "utf8_bytewise_%s", texts[i].name);
+        report(name, &none, "utf8", "MB/s", d.len / measure(decode_bytewise, NULL, &d) / 1e6);
+        snprintf(name, sizeof(name), "utf8_bulk_%s", texts[i].name);
+        report(name, &none, "utf8", "MB/s", d.len / measure(decode_bulk, NULL, &d) / 1e6);
+    }
+    free(d.data);
+    free(d.out);
+}
+
+//======== Driver ========//
+
+static void bench_format(format_t* format, uint32_t width, uint32_t height, font_t* font, font_t* ttf) {
+    dazzle_allocator_t alloc = {malloc, free};
+    dazzle_context_t* ctx = dazzle_init_memory(alloc, width, height, &format->fb);
+    if (ctx == NULL) {
+        fprintf(stderr, "Failed to create a %ux%u %s context\n", width, height, format->name);
+        return;
+    }
+    dazzle_framebuffer_t* fb = dazzle_memory_framebuffer(ctx);
+    double t;
+
+    t = measure(clear_screen, ctx, NULL);
+    report("clear", fb, format->name, "Mpix/s", (double)width * height / t / 1e6);
+
+    static const struct {
+        const char* name;
+        int kind;
+        bool filled;
+    } shapes[] = {
+        {"rect_filled", DAZZLE_RETAINED_RECTANGLE, true},
+        {"rect_outline", DAZZLE_RETAINED_RECTANGLE, false},
+        {"triangle_filled", DAZZLE_RETAINED_TRIANGLE, true},
+        {"triangle_outline", DAZZLE_RETAINED_TRIANGLE, false},
+        {"circle_filled", DAZZLE_RETAINED_CIRCLE, true},
+        {"circle_outline", DAZZLE_RETAINED_CIRCLE, false},
+    };
+
+    for (size_t i = 0; i < sizeof(shapes) / sizeof(shapes[0]); i++) {
+        element_set_t set;
+        build_set(ctx, fb, &set, shapes[i].kind, shapes[i].filled);
+        t = measure(draw_set, ctx, &set);
+        report(shapes[i].name, fb, format->name, "Mpix/s", set.pixels / t / 1e6);
+        free_set(ctx, &set);
+    }
+
+    if (font != NULL) {
+        glyph_args_t g = {font, 1024, NULL, 1};
+        t = measure(glyph_render_blit, ctx, &g);
+        report("glyph_render_blit", fb, format->name, "glyphs/s", g.glyphs / t);
+
+        t = measure(glyph_direct, ctx, &g);
+        report("glyph_direct", fb, format->name, "glyphs/s", g.glyphs / t);
+
+        // Scaled glyphs report pixels, which should stay close to the 1x rate
+        double glyph_pixels = (double)font->suggested_width * font->suggested_height;
+        report("glyph_direct_mpix", fb, format->name, "Mpix/s", g.glyphs * glyph_pixels / t / 1e6);
+        for (g.scale = 2; g.scale <= 4; g.scale++) {
+            char name[32];
+            snprintf(name, sizeof(name), "glyph_scaled_%ux", g.scale);
+            t = measure(glyph_direct, ctx, &g);
+            report(name, fb, format->name, "Mpix/s", g.glyphs * glyph_pixels * g.scale * g.scale / t / 1e6);
+        }
+        g.scale = 1;
+
+        t = measure(text_lines, ctx, &g);
+        report("text_lines", fb, format->name, "glyphs/s", g.glyphs / t);
+
+        g.cache = create_glyph_cache(ctx, font->suggested_width, font->suggested_height, 256 * 1024);
+        if (g.cache != NULL) {
+            t = measure(glyph_cached, ctx, &g);
+            report("glyph_cached", fb, format->name, "glyphs/s", g.glyphs / t);
+            glyph_cache_destroy(g.cache);
+        }
+    }
+
+    // Outlines are rasterized on the warm-up pass, after that it's coverage blending only
+    if (ttf != NULL) {
+        glyph_args_t g = {ttf, 1024, NULL, 1};
+        t = measure(glyph_direct, ctx, &g);
+        report("glyph_ttf", fb, format->name, "glyphs/s", g.glyphs / t);
+    }
+
+    // Redraw cost as the retained list grows, with small mixed elements
+    uint32_t count = 0;
+    for (uint32_t target = 16; target <= 4096; target *= 4) {
+        for (; count < target; count++) {
+            uint32_t x = rnd(width - 32), y = rnd(height - 32);
+            uint32_t color = 0xFF000000 | (uint32_t)rand();
+            dazzle_retained_element_t* e;
+            switch (count % 3) {
+                case 0: e = dazzle_create_rectangle(ctx, x, y, 24, 16, true, color); break;
+                case 1: e = dazzle_create_circle(ctx, x + 12, y + 12, 10, true, color); break;
+                default: e = dazzle_create_triangle(ctx, x, y, x + 24, y, x + 12, y + 20, true, color); break;
+            }
+            dazzle_add(ctx, e);
+        }
+
+        char name[32];
+        snprintf(name, sizeof(name), "redraw_%u", target);
+        t = measure(redraw, ctx, NULL);
+        report(name, fb, format->name, "ms", t * 1e3);
+    }
+
+    dazzle_retained_element_t* e = ctx->retained;
+    while (e != NULL) {
+        dazzle_retained_element_t* next = e->next;
+        ctx->alloc.free(e);
+        e = next;
+    }
+    dazzle_memory_destroy(ctx);
+}
+
+int main(int argc, char** argv) {
+    const char* font_path = argc > 1 ? argv[1] : "test.psf";
+    if (argc > 2)
+        min_seconds = atof(argv[2]);
+
+    dazzle_allocator_t alloc = {malloc, free};
+    font_t font = load_font_mapped(alloc, font_path);
+    font_t* fontp = font.format != BT_INVALID_FORMAT ? &font : NULL;
+    if (fontp == NULL)
+        fprintf(stderr, "No usable font at %s, skipping glyph benchmarks\n", font_path);
+
+    font_t ttf = load_font_mapped(alloc, argc > 3 ? argv[3] : "");
+    font_t* ttfp = ttf.format == BT_FORMAT_TTF ? &ttf : NULL;
+
+    format_t formats[] = {
+        {"xrgb8888", {.bpp = 32, .red_mask = 0xFF, .green_mask = 0xFF, .blue_mask = 0xFF, .alpha_mask = 0xFF,
+                      .red_shift = 16, .green_shift = 8, .blue_shift = 0, .alpha_shift = 24}},
+        {"rgb888", {.bpp = 24, .red_mask = 0xFF, .green_mask = 0xFF, .blue_mask = 0xFF,
+                    .red_shift = 16, .green_shift = 8, .blue_shift = 0}},
+        {"rgb565", {.bpp = 16, .red_mask = 0x1F, .green_mask = 0x3F, .blue_mask = 0x1F,
+                    .red_shift = 11, .green_shift = 5, .blue_shift = 0}},
+    };
+    static const uint32_t resolutions[][2] = {{640, 480}, {1280, 720}, {1920, 1080}};
+
+    for (size_t r = 0; r < sizeof(resolutions) / sizeof(resolutions[0]); r++) {
+        for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+            srand(1);
+            bench_format(&formats[f], resolutions[r][0], resolutions[r][1], fontp, ttfp);
+        }
+    }
+
+    bench_decode();
+
+    if (fontp != NULL)
+        font_release(&font);
+    if (ttfp != NULL)
+        font_release(&ttf);
+    return 0;
+}
@@ -11,6 +11,7 @@
 #include <sys/ioctl.h>
 
 #define __DAZZLE_IMPL__
+#define DAZZLE_BACKEND_DRM
 
 #include <bt.h>
 #include <dt_glyphs.h>
@@ -90,74 +91,140 @@ connected_connectors enumerate_resources(int fd) {
     return (connected_connectors){count_connectors, connectors}; // WIP
 }
 
-typedef struct {
-    drmModeCrtc *crtc;
-    uint32_t handle;
-    uint32_t pitch;
-    uint64_t size;
-    uint32_t fb_id;
-    uint64_t offset;
-    uint8_t *fb_ptr;
-} framebuffer;
-
-framebuffer setup_framebuffer(int fd, drmModeConnector *connector,int mode_num) {
+uint32_t find_crtc(int fd, drmModeConnector *connector) {
     drmModeEncoder* encoder = drmModeGetEncoder(fd, connector->encoders[0]);
 
     if (encoder == NULL) {
         printf("Failed to get encoder\n");
-        return (framebuffer){};
+        return 0;
     }
 
     printf("Using encoder %d\n", encoder->encoder_id);
 
-    drmModeCrtc* crtc = drmModeGetCrtc(fd, encoder->crtc_id);
+    uint32_t crtc_id = encoder->crtc_id;
 
-    if (crtc == NULL) {
+    // Nothing drives this encoder yet (e.g. a fresh vkms device), pick any CRTC it can use
+    if (crtc_id == 0) {
+        drmModeRes *resources = drmModeGetResources(fd);
+        for (int i = 0; resources != NULL && i < resources->count_crtcs; i++) {
+            if (encoder->possible_crtcs & (1 << i)) {
+                crtc_id = resources->crtcs[i];
+                break;
+            }
+        }
+        drmModeFreeResources(resources);
+    }
+    drmModeFreeEncoder(encoder);
+
+    if (crtc_id == 0) {
         printf("Failed to get crtc\n");
-        return (framebuffer){};
+        return 0;
     }
 
-    printf("Using CRTC %d\n", crtc->crtc_id);
+    printf("Using CRTC %d\n", crtc_id);
+    return crtc_id;
+}
 
-    uint32_t handle;
-    uint32_t pitch;
-    uint64_t size;
-    if(drmModeCreateDumbBuffer(fd, connector->modes[mode_num].hdisplay, connector->modes[mode_num].vdisplay, 32,0 , &handle, &pitch, &size)){
-        printf("Failed to create dumb buffer\n");
-        return (framebuffer){};
-    }
 
-    uint32_t fb;
-    if (drmModeAddFB(fd, connector->modes[mode_num].hdisplay, connector->modes[mode_num].vdisplay, 24, 32, pitch, handle, &fb)){
-        printf("Failed to add framebuffer\n");
-        return (framebuffer){};
-    }
+static bool write_file(void* user, const void* data, size_t len) {
+    return fwrite(data, 1, len, (FILE*)user) == len;
+}
+
+// Everything one output needs, each one is drawn on its own thread
+typedef struct {
+    glyph_set_t* glyphs;
+    uint32_t glyph_end_y;
+    dazzle_retained_element_t* erase;
+    dazzle_retained_element_t* box;
+    uint32_t box_x, last_x, size;
+    int32_t dir;
+} output_t;
 
-    uint64_t offset;
-    if (drmModeMapDumbBuffer(fd, handle, &offset)) {
-        printf("Failed to prepare dumb buffer for use\n");
-        return (framebuffer){};
+typedef struct {
+    output_t* outputs;
+    int frame;
+} frame_args_t;
+
+static bool draw_glyphs(dazzle_context_t* ctx, output_t* out) {
+    dazzle_framebuffer_t* fb = (dazzle_framebuffer_t*)ctx->renderer_data;
+    uint32_t posx = 0;
+    uint32_t posy = 0;
+
+    dazzle_clear(ctx, 0x00000000);
+    for (uint32_t i = 0; i < out->glyphs->count; i++) {
+        dazzle_image_t* glyph = out->glyphs->glyphs[i];
+        if (glyph == NULL) {
+            continue;
+        }
+        // Converted once for the first output with this pixel format, shared by the rest
+        dazzle_retained_element_t* e = dazzle_create_image_blitable(ctx, posx, posy, glyph);
+        if (e == NULL) {
+            return false;
+        }
+        dazzle_draw(ctx, e);
+        ctx->alloc.free(e);
+        posx += glyph->width;
+        if (posx >= (fb->width - glyph->width)) {
+            posx = 0;
+            posy += glyph->height;
+        }
     }
+    out->glyph_end_y = posy;
+    return dazzle_drm_present(ctx);
+}
+
+static bool render_output(dazzle_context_t* ctx, uint32_t index, void* user) {
+    frame_args_t* args = user;
+    output_t* out = &args->outputs[index];
+    dazzle_framebuffer_t* fb = (dazzle_framebuffer_t*)ctx->renderer_data;
+
+    if (args->frame == 0) {
+        if (!draw_glyphs(ctx, out)) {
+            printf("Failed to modeset crtc\n");
+            return false;
+        }
 
-    uint8_t *fb_ptr = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, offset);
-    if (fb_ptr == MAP_FAILED) {
-        printf("Failed to mmap framebuffer\n");
-        return (framebuffer){};
+        // Bounce a square below the glyphs, every frame is a vblank-synced page flip
+        uint32_t box_y = out->glyph_end_y + out->glyphs->font.suggested_height * 2;
+        if (box_y + out->size > fb->height) {
+            box_y = fb->height - out->size;
+        }
+        out->erase = dazzle_create_rectangle(ctx, 0, box_y, out->size, out->size, true, 0x00000000);
+        out->box = dazzle_create_rectangle(ctx, 0, box_y, out->size, out->size, true, 0x0000FF00);
+        return out->erase != NULL && out->box != NULL;
     }
 
-    return (framebuffer){crtc,handle, pitch, size, fb, offset, fb_ptr};
+    out->erase->type_data.rect.x = out->last_x;
+    out->box->type_data.rect.x = out->box_x;
+    dazzle_draw(ctx, out->erase);
+    dazzle_draw(ctx, out->box);
+    if (!dazzle_drm_present(ctx)) {
+        printf("Page flip failed\n");
+        return false;
+    }
+    out->last_x = out->box_x;
+    if ((out->dir < 0 && out->box_x < (uint32_t)-out->dir) || (out->dir > 0 && out->box_x + out->size + out->dir > fb->width)) {
+        out->dir = -out->dir;
+    }
+    out->box_x += out->dir;
+    return true;
 }
 
-
 int main(int argc,char** argv) {
 
     int fd = init_drm();
 
     int mode_id = 0;
+    int buffer_count = 2;
+    int frames = 300;
 
     if (argc > 1){
    	mode_id = atoi(argv[1]);
     }
+    if (argc > 2){
+        buffer_count = atoi(argv[2]);
+    }
+    const char* trace_path = argc > 3 ? argv[3] : NULL;
     
     
 
@@ -173,78 +240,97 @@ int main(int argc,char** argv) {
         printf("Process is not the DRM master\n");
         return 1;
     }
+
+    dazzle_allocator_t alloc;
+    alloc.malloc = malloc;
+    alloc.free = free;
+
+    if (trace_path != NULL) {
+        dazzle_trace_enable(alloc);
+    }
+
+    // The font is loaded and rendered once, every output shares it
+    font_t font = load_font_mapped(alloc, "test.psf");
+    if(font.format == BT_INVALID_FORMAT) {
+        printf("Failed to load test.psf\n");
+        return 1;
+    }
+
+    printf("Font type: %s\n", font.format == BT_FORMAT_PSF1 ? "PSF1" : 
+                              font.format == BT_FORMAT_PSF2 ? "PSF2" : 
+                              font.format == BT_FORMAT_TTF ? "TTF" : "Unknown");
+    printf("Glyph count: %d\n", font.glyph_count);
+    printf("Suggested width: %d\n", font.suggested_width);
+    printf("Suggested height: %d\n", font.suggested_height);
+    printf("bytes per glyph: %d\n", font.psfx_bytes_per_glyph);
+
+    glyph_set_t* glyphs = create_glyph_set(font, 0x000000FF);
+    font_release(&font);
+    if (glyphs == NULL) {
+        printf("Failed to render the font\n");
+        return 1;
+    }
+
+    dazzle_context_t** contexts = calloc(connectors.count, sizeof(dazzle_context_t*));
+    output_t* outputs = calloc(connectors.count, sizeof(output_t));
     
     for (int i = 0; i < connectors.count; i++) {
         drmModeConnector *connector = connectors.connectors[i];
         printf("Modesetting connector %d: %dx%d\n", connector->connector_id, connector->modes[mode_id].hdisplay, connector->modes[mode_id].vdisplay);
 
-        framebuffer fb = setup_framebuffer(fd, connector,mode_id);
-
-        dazzle_allocator_t alloc;
-        alloc.malloc = malloc;
-        alloc.free = free;
-        
-        dazzle_framebuffer_t daz_fb;
-        daz_fb.address         = (uintptr_t)fb.fb_ptr;
-        daz_fb.width           = connector->modes[mode_id].hdisplay;
-        daz_fb.height          = connector->modes[mode_id].vdisplay;
-        daz_fb.pitch           = fb.pitch;
-        daz_fb.bpp             = 32;
-        daz_fb.red_mask        = 0xFF; 
-        daz_fb.green_mask      = 0xFF;
-        daz_fb.blue_mask       = 0xFF;
-        daz_fb.alpha_mask      = 0xFF;
-        daz_fb.red_shift       = 16;
-        daz_fb.green_shift     = 8;
-        daz_fb.blue_shift      = 0;
-        daz_fb.alpha_shift     = 24;
-        
-        dazzle_context_t* ctx = dazzle_init_fb(alloc, &daz_fb);
-        
-        FILE* f = fopen("test.psf", "rb");
-        if(f == NULL) {
-            printf("Failed to open test.psf\n");
+        uint32_t crtc_id = find_crtc(fd, connector);
+        if (crtc_id == 0) {
             return 1;
         }
-        fseek(f, 0, SEEK_END);
-        int fsize = ftell(f);
-        fseek(f, 0, SEEK_SET);
-        uint8_t* psf = malloc(fsize);
-        fread(psf, fsize, 1, f);
-        fclose(f);
-    
-        font_t font = load_font(alloc, psf, fsize);
-    
-        printf("Framebuffer resolution: %dx%d\n",daz_fb.width,daz_fb.height);
-        printf("Font type: %s\n", font.format == BT_FORMAT_PSF1 ? "PSF1" : 
-                                  font.format == BT_FORMAT_PSF2 ? "PSF2" : 
-                                  font.format == BT_FORMAT_TTF ? "TTF" : "Unknown");
-        printf("Glyph count: %d\n", font.glyph_count);
-        printf("Suggested width: %d\n", font.suggested_width);
-        printf("Suggested height: %d\n", font.suggested_height);
-        printf("bytes per glyph: %d\n", font.psfx_bytes_per_glyph);
-        
-        dazzle_clear(ctx, 0x00000000);
-        
-        uint32_t posx = 0;
-        uint32_t posy = 0;
-        for(int i = 0; i < font.glyph_count; i++){
-            glyph_t glyph = render_glyph(font, i,0,0x000000FF);
-            dazzle_draw(ctx, dazzle_create_blitable(ctx, posx, posy, glyph.width, glyph.height, glyph.buffer));
-            posx += glyph.width;
-            if(posx >= (daz_fb.width - glyph.width)){
-                posx = 0;
-                posy += glyph.height;
-            }
+
+        contexts[i] = dazzle_init_drm(alloc, fd, connector->connector_id, crtc_id, &connector->modes[mode_id], buffer_count);
+        if (contexts[i] == NULL) {
+            printf("Failed to set up %d dumb buffers\n", buffer_count);
+            return 1;
         }
+        dazzle_framebuffer_t* daz_fb = (dazzle_framebuffer_t*)contexts[i]->renderer_data;
+        printf("Framebuffer resolution: %dx%d\n",daz_fb->width,daz_fb->height);
 
-        if(drmModeSetCrtc(fd, fb.crtc->crtc_id, fb.fb_id, 0, 0, &connector->connector_id, 1, &connector->modes[mode_id])){
-            printf("Failed to modeset crtc\n");
+        outputs[i].glyphs = glyph_set_retain(glyphs);
+        outputs[i].size = 64;
+        outputs[i].dir = 8;
+    }
+
+    // One thread per output, so frame time doesn't grow with the number of heads
+    dazzle_group_t* group = dazzle_group_create(alloc, contexts, connectors.count);
+    if (group == NULL) {
+        printf("Failed to start render threads\n");
+        return 1;
+    }
+
+    frame_args_t args = {outputs, 0};
+    for (args.frame = 0; args.frame <= frames; args.frame++) {
+        if (!dazzle_group_render(group, render_output, &args)) {
             return 1;
         }
     }
+    dazzle_group_destroy(group);
 
-    pause();
+    for (int i = 0; i < connectors.count; i++) {
+        alloc.free(outputs[i].erase);
+        alloc.free(outputs[i].box);
+        glyph_set_release(outputs[i].glyphs);
+        dazzle_drm_destroy(contexts[i]);
+    }
+    glyph_set_release(glyphs);
+    free(outputs);
+    free(contexts);
+
+    if (trace_path != NULL) {
+        // Open it in chrome://tracing or ui.perfetto.dev
+        FILE* out = fopen(trace_path, "w");
+        if (out == NULL || !dazzle_trace_dump(write_file, out)) {
+            printf("Failed to write trace to %s\n", trace_path);
+        }
+        if (out != NULL) {
+            fclose(out);
+        }
+    }
 
     return 0;
 
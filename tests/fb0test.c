@@ -11,6 +11,7 @@
 #define __DAZZLE_IMPL__
 #include <bt.h>
 #include <dt_glyphs.h>
+#include <dt_text.h>
 
 int main(int argc, char **argv) {
 
@@ -65,19 +66,11 @@ int main(int argc, char **argv) {
 
     dazzle_context_t* ctx = dazzle_init_fb(alloc, &fb);
 
-    FILE* f = fopen("test.psf", "rb");
-    if(f == NULL) {
-        printf("Failed to open test.psf\n");
+    font_t font = load_font_mapped(alloc, "test.psf");
+    if(font.format == BT_INVALID_FORMAT) {
+        printf("Failed to load test.psf\n");
         return 1;
     }
-    fseek(f, 0, SEEK_END);
-    int fsize = ftell(f);
-    fseek(f, 0, SEEK_SET);
-    uint8_t* psf = malloc(fsize);
-    fread(psf, fsize, 1, f);
-    fclose(f);
-
-    font_t font = load_font(alloc, psf, fsize);
 
     printf("Framebuffer resolution: %dx%d\n",fb.width,fb.height);
     printf("Font type: %s\n", font.format == BT_FORMAT_PSF1 ? "PSF1" : 
@@ -102,6 +95,21 @@ int main(int argc, char **argv) {
         }
     }
 
+    const char* text = "The quick brown fox jumps over the lazy dog\n\xe2\x94\x8c\xe2\x94\x80 draw_text \xe2\x94\x80\xe2\x94\x90";
+    draw_text(ctx, font, 0, posy + font.suggested_height * 2, text, strlen(text), 0xFFFFFFFF, 0x00000000);
+
+    // Characters test.psf lacks come from the fonts after it
+    font_t fallback[2] = {font, load_font_mapped(alloc, "test1.psf")};
+    font_chain_t* chain = fallback[1].format == BT_INVALID_FORMAT ? NULL : create_font_chain(alloc, fallback, 2);
+    if (chain != NULL) {
+        const char* mixed = "Latin \xd0\x9a\xd0\xb8\xd1\x80\xd0\xb8\xd0\xbb\xd0\xbb\xd0\xb8\xd1\x86\xd0\xb0 \xe2\x94\x8c\xe2\x94\x80\xe2\x94\x90";
+        draw_text_chain(ctx, chain, 0, posy + font.suggested_height * 5, mixed, strlen(mixed), 0xFFFFFFFF, 0x00000000);
+        font_chain_destroy(chain);
+    }
+    // The chain takes its own references, ours to the fallback font is done
+    if (fallback[1].format != BT_INVALID_FORMAT)
+        font_release(&fallback[1]);
+
     while (true){
 	//nothing to do for now
     }
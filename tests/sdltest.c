@@ -44,27 +44,19 @@ int main(int argc, char **argv) {
     uint32_t posy = 0;
 
     for(int i = 0; i < 10; i++) {
-        FILE* f;
         char name[32];
         if (i != 0){
             sprintf(name, "test%d.psf", i);
-            f = fopen(name, "rb");
         } else {
-            f = fopen("test.psf", "rb");
+            sprintf(name, "test.psf");
         }
-        if(f == NULL) {
+
+        font_t font = load_font_mapped(alloc, name);
+        if(font.format == BT_INVALID_FORMAT) {
             continue;
         }
-        fseek(f, 0, SEEK_END);
-        int fsize = ftell(f);
-        fseek(f, 0, SEEK_SET);
-        uint8_t* psf = malloc(fsize);
-        fread(psf, fsize, 1, f);
-        fclose(f);
-
-        font_t font = load_font(alloc, psf, fsize);
 
-        printf("====== Font %s ======\n", i == 0 ? "test.psf" : name);
+        printf("====== Font %s ======\n", name);
 
         printf("Font type: %s\n", font.format == BT_FORMAT_PSF1 ? "PSF1" : 
                                   font.format == BT_FORMAT_PSF2 ? "PSF2" : 
@@ -87,7 +79,7 @@ int main(int argc, char **argv) {
             }
         }
         posy += font.suggested_height;
-        free(psf);
+        font_release(&font);
     }
     
 
@@ -0,0 +1,332 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <termios.h>
+
+#define __DAZZLE_IMPL__
+#include <bt.h>
+#include <dt_glyphs.h>
+#include <dt_fallback.h>
+
+// Headless terminal benchmark in the spirit of vtebench: streams of terminal
+// output go through the parser and grid and are drawn into a memory framebuffer,
+// a frame whenever one is due at FRAME_HZ, the way bt_pty paces them.
+// Prints one JSON object per line, like bench:
+//   {"bench":"...","width":W,"height":H,"format":"...","unit":"...","value":V}
+// Usage: ./termbench [font.psf] [fallback.ttf] [recorded stream...]
+// A recorded stream is raw pty output, like from `script -q /dev/null -c cmd`.
+
+#define COLS 160
+#define ROWS 48
+#define STREAM_BYTES (8 << 20)
+#define FRAME_HZ 60
+#define KEYSTROKES 200
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void report(const char* bench, dazzle_framebuffer_t* fb, const char* format, const char* unit, double value) {
+    printf("{\"bench\":\"%s\",\"width\":%u,\"height\":%u,\"format\":\"%s\",\"unit\":\"%s\",\"value\":%.3f}\n",
+           bench, fb->width, fb->height, format, unit, value);
+    fflush(stdout);
+}
+
+//======== Streams ========//
+
+typedef struct {
+    uint8_t* data;
+    size_t len;
+} stream_t;
+
+static void put(stream_t* s, const char* text) {
+    size_t len = strlen(text);
+    if (s->len + len <= STREAM_BYTES) {
+        memcpy(s->data + s->len, text, len);
+        s->len += len;
+    }
+}
+
+static bool full(const stream_t* s) {
+    return s->len + 256 > STREAM_BYTES;
+}
+
+static const char* words[] = {"the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "request", "handled",
+                              "server", "0x7f3a", "INFO", "error:", "path=/api/v1/items", "42ms", "user", "cache"};
+
+// Log lines of words, the output of cat or a build
+static void gen_ascii(stream_t* s) {
+    while (!full(s)) {
+        uint32_t col = 0;
+        while (col < COLS - 20) {
+            const char* w = words[rand() % (sizeof(words) / sizeof(words[0]))];
+            put(s, w);
+            put(s, " ");
+            col += strlen(w) + 1;
+        }
+        put(s, "\r\n");
+    }
+}
+
+// A color change every word or two, like ls --color or a syntax highlighter
+static void gen_sgr(stream_t* s) {
+    char sgr[48];
+    while (!full(s)) {
+        for (uint32_t col = 0; col < COLS - 20;) {
+            switch (rand() % 4) {
+                case 0: snprintf(sgr, sizeof(sgr), "\x1b[3%dm", rand() % 8); break;
+                case 1: snprintf(sgr, sizeof(sgr), "\x1b[1;38;5;%dm", rand() % 256); break;
+                case 2: snprintf(sgr, sizeof(sgr), "\x1b[38;2;%d;%d;%d;48;5;%dm", rand() % 256, rand() % 256, rand() % 256, rand() % 256); break;
+                default: snprintf(sgr, sizeof(sgr), "\x1b[0m"); break;
+            }
+            put(s, sgr);
+            const char* w = words[rand() % (sizeof(words) / sizeof(words[0]))];
+            put(s, w);
+            put(s, " ");
+            col += strlen(w) + 1;
+        }
+        put(s, "\x1b[0m\r\n");
+    }
+}
+
+// Short lines, almost all the work is scrolling, like yes or tail -f of a busy log
+static void gen_scroll(stream_t* s) {
+    char line[16];
+    for (uint32_t i = 0; !full(s); i++) {
+        snprintf(line, sizeof(line), "%u\r\n", i);
+        put(s, line);
+    }
+}
+
+// CJK, emoji and accented text, every line mostly wide characters
+static void gen_cjk(stream_t* s) {
+    static const char* pieces[] = {"\xe6\xbc\xa2\xe5\xad\x97", "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e", "\xed\x95\x9c\xea\xb5\xad\xec\x96\xb4",
+                                   "\xf0\x9f\x98\x80", "\xe4\xb8\xad\xe6\x96\x87\xe6\xb8\xac\xe8\xa9\xa6", "caf\xc3\xa9", " "};
+    while (!full(s)) {
+        for (uint32_t i = 0; i < 40; i++)
+            put(s, pieces[rand() % (sizeof(pieces) / sizeof(pieces[0]))]);
+        put(s, "\r\n");
+    }
+}
+
+// Whole screens drawn by cursor position with a few changes each, like top or a full screen editor
+static void gen_redraw(stream_t* s) {
+    char cell[64];
+    for (uint32_t frame = 0; !full(s); frame++) {
+        put(s, "\x1b[H");
+        for (uint32_t row = 0; row < ROWS && !full(s); row++) {
+            snprintf(cell, sizeof(cell), "\x1b[%u;1H\x1b[%dm%5u ", row + 1, row == 0 ? 7 : 0, row * 100 + frame % 7);
+            put(s, cell);
+            snprintf(cell, sizeof(cell), "root  20  0 %8u %6u S %4.1f %5.1f ", frame * 13 + row, row * 7, (frame + row) % 100 / 10.0, row / 3.0);
+            put(s, cell);
+            put(s, words[(frame + row) % (sizeof(words) / sizeof(words[0]))]);
+            put(s, "\x1b[0m\x1b[K");
+        }
+    }
+}
+
+static bool load_stream(stream_t* s, const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (f == NULL)
+        return false;
+    s->len = fread(s->data, 1, STREAM_BYTES, f);
+    fclose(f);
+    return s->len > 0;
+}
+
+//======== Throughput ========//
+
+typedef struct {
+    dazzle_context_t* ctx;
+    const font_chain_t* fonts;
+    dazzle_framebuffer_t* fb;
+} screen_t;
+
+// Feeds a stream in reads of BT_PTY_READ_SIZE, drawing whenever a frame is due
+static void bench_stream(screen_t* screen, const char* name, const stream_t* s) {
+    dazzle_allocator_t alloc = {malloc, free};
+    bt_grid_t* grid = bt_grid_create(alloc, COLS, ROWS);
+    bt_vt_t* vt = bt_vt_create(alloc, grid, NULL);
+    if (grid == NULL || vt == NULL) {
+        bt_vt_destroy(vt);
+        bt_grid_destroy(grid);
+        return;
+    }
+
+    uint64_t frames = 0;
+    double start = now(), last_frame = 0;
+    for (size_t i = 0; i < s->len; i += BT_PTY_READ_SIZE) {
+        bt_vt_feed(vt, s->data + i, s->len - i < BT_PTY_READ_SIZE ? s->len - i : BT_PTY_READ_SIZE);
+        double t = now();
+        if (t - last_frame >= 1.0 / FRAME_HZ) {
+            bt_grid_render(screen->ctx, grid, screen->fonts, 0, 0, NULL);
+            last_frame = t;
+            frames++;
+        }
+    }
+    bt_grid_render(screen->ctx, grid, screen->fonts, 0, 0, NULL);
+    frames++;
+    double elapsed = now() - start;
+
+    char bench[64];
+    snprintf(bench, sizeof(bench), "term_%s", name);
+    report(bench, screen->fb, "xrgb8888", "MB/s", s->len / elapsed / 1e6);
+    snprintf(bench, sizeof(bench), "term_%s_frames", name);
+    report(bench, screen->fb, "xrgb8888", "frames", frames);
+
+    bt_vt_destroy(vt);
+    bt_grid_destroy(grid);
+}
+
+//======== Latency ========//
+
+typedef struct {
+    double presented;
+    uint64_t count;
+} presents_t;
+
+static void on_present(void* user, dazzle_context_t* ctx, dazzle_rect_t damage) {
+    (void)ctx;
+    (void)damage;
+    presents_t* p = user;
+    p->presented = now();
+    p->count++;
+}
+
+// Keystroke latency: a key goes in through bt_pty_write, the line discipline of
+// a real pty echoes it back, nothing runs there, and it is timed until its frame
+// is drawn. Canonical mode is off so every key is echoed as soon as it arrives.
+static void bench_latency(screen_t* screen) {
+    dazzle_allocator_t alloc = {malloc, free};
+    int master, slave;
+    if (openpty(&master, &slave, NULL, NULL, NULL) < 0) {
+        fprintf(stderr, "openpty failed, skipping latency\n");
+        return;
+    }
+    struct termios echo;
+    tcgetattr(slave, &echo);
+    cfmakeraw(&echo);
+    echo.c_lflag |= ECHO;
+    tcsetattr(slave, TCSANOW, &echo);
+
+    presents_t presents = {0, 0};
+    bt_grid_t* grid = bt_grid_create(alloc, COLS, ROWS);
+    bt_vt_t* vt = bt_vt_create(alloc, grid, NULL);
+    bt_pty_output_t output = {screen->ctx, screen->fonts, 0, 0, FRAME_HZ, on_present, &presents};
+    bt_pty_t* pty = grid != NULL && vt != NULL ? bt_pty_attach(alloc, master, vt, &output) : NULL;
+    if (pty == NULL) {
+        fprintf(stderr, "Failed to set up the pty loop, skipping latency\n");
+    } else {
+        // Idle: a key after the last frame is long done. Busy: a key right after a frame, it waits for the next.
+        for (int busy = 0; busy < 2; busy++) {
+            double total = 0, worst = 0;
+            int samples = 0;
+            for (int i = 0; i < KEYSTROKES; i++) {
+                if (!busy) {
+                    struct timespec gap = {0, 1000000000 / FRAME_HZ + 1000000};
+                    nanosleep(&gap, NULL);
+                }
+                // The echo moves along the line, so every key lands on a cell that changes
+                char key = 'a' + i % 26;
+                uint64_t before = presents.count;
+                double sent = now();
+                if (!bt_pty_write(pty, &key, 1))
+                    break;
+                bool polling = true;
+                while (presents.count == before && (polling = bt_pty_poll(pty, 100)))
+                    ;
+                // The loop failed before drawing this key, its frame time is an older one
+                if (presents.count == before) {
+                    fprintf(stderr, "The pty loop stopped, %d of %d keystrokes timed\n", samples, KEYSTROKES);
+                    break;
+                }
+                double latency = (presents.presented - sent) * 1e3;
+                total += latency;
+                if (latency > worst)
+                    worst = latency;
+                samples++;
+                if (!polling)
+                    break;
+            }
+            if (samples == 0)
+                continue;
+            report(busy ? "term_keystroke_busy_avg" : "term_keystroke_idle_avg", screen->fb, "xrgb8888", "ms", total / samples);
+            report(busy ? "term_keystroke_busy_max" : "term_keystroke_idle_max", screen->fb, "xrgb8888", "ms", worst);
+        }
+    }
+
+    bt_pty_destroy(pty);
+    bt_vt_destroy(vt);
+    bt_grid_destroy(grid);
+    close(master);
+    close(slave);
+}
+
+//======== Driver ========//
+
+int main(int argc, char** argv) {
+    dazzle_allocator_t alloc = {malloc, free};
+    font_t fonts[2];
+    uint32_t font_count = 0;
+    fonts[font_count] = load_font_mapped(alloc, argc > 1 ? argv[1] : "test.psf");
+    if (fonts[font_count].format == BT_INVALID_FORMAT) {
+        fprintf(stderr, "No usable font at %s\n", argc > 1 ? argv[1] : "test.psf");
+        return 1;
+    }
+    font_count++;
+    fonts[font_count] = load_font_mapped(alloc, argc > 2 ? argv[2] : "");
+    if (fonts[font_count].format != BT_INVALID_FORMAT)
+        font_count++;
+
+    font_chain_t* chain = create_font_chain(alloc, fonts, font_count);
+    dazzle_framebuffer_t format = {.bpp = 32, .red_mask = 0xFF, .green_mask = 0xFF, .blue_mask = 0xFF, .alpha_mask = 0xFF,
+                                   .red_shift = 16, .green_shift = 8, .blue_shift = 0, .alpha_shift = 24};
+    uint32_t width = COLS * fonts[0].suggested_width, height = ROWS * fonts[0].suggested_height;
+    dazzle_context_t* ctx = chain != NULL ? dazzle_init_memory(alloc, width, height, &format) : NULL;
+    stream_t stream = {malloc(STREAM_BYTES), 0};
+    if (ctx == NULL || stream.data == NULL) {
+        fprintf(stderr, "Failed to create a %ux%u context\n", width, height);
+        return 1;
+    }
+    screen_t screen = {ctx, chain, dazzle_memory_framebuffer(ctx)};
+
+    static const struct {
+        const char* name;
+        void (*generate)(stream_t* s);
+    } streams[] = {
+        {"ascii", gen_ascii},
+        {"sgr", gen_sgr},
+        {"scroll", gen_scroll},
+        {"cjk", gen_cjk},
+        {"redraw", gen_redraw},
+    };
+    for (size_t i = 0; i < sizeof(streams) / sizeof(streams[0]); i++) {
+        srand(1);
+        stream.len = 0;
+        streams[i].generate(&stream);
+        bench_stream(&screen, streams[i].name, &stream);
+    }
+
+    for (int i = 3; i < argc; i++) {
+        if (!load_stream(&stream, argv[i])) {
+            fprintf(stderr, "Could not read %s\n", argv[i]);
+            continue;
+        }
+        const char* name = strrchr(argv[i], '/');
+        bench_stream(&screen, name != NULL ? name + 1 : argv[i], &stream);
+    }
+
+    bench_latency(&screen);
+
+    free(stream.data);
+    dazzle_memory_destroy(ctx);
+    font_chain_destroy(chain);
+    for (uint32_t i = 0; i < font_count; i++)
+        font_release(&fonts[i]);
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define __DAZZLE_IMPL__
+#include <bt.h>
+
+// Checks of the terminal parser against what the grid should hold afterwards.
+// Prints every failure and exits with the number of them.
+// Usage: ./vttest
+
+#define COLS 12
+#define ROWS 3
+
+typedef struct {
+    const char* name;
+    const char* input;
+    const char* row; // the first row as text, wide characters once, trailing blanks dropped
+} vt_case_t;
+
+static const vt_case_t cases[] = {
+    {"ich on the right half of a wide character", "\xe4\xb8\xad" "AB\x1b[1;2H\x1b[@", "   AB"},
+    {"dch on the left half of a wide character", "\xe4\xb8\xad" "AB\x1b[1;1H\x1b[P", " AB"},
+    {"ich before a wide character", "A\xe4\xb8\xad" "B\x1b[1;1H\x1b[@", " A\xe4\xb8\xad" "B"},
+    {"dch before a wide character", "A\xe4\xb8\xad" "B\x1b[1;1H\x1b[P", "\xe4\xb8\xad" "B"},
+    {"ich pushing a wide character off the row", "ABCDEFGHIJ\xe4\xb8\xad\x1b[1;1H\x1b[@", " ABCDEFGHIJ"},
+    {"dch of the cells up to a right half", "AB\xe4\xb8\xad" "C\x1b[1;1H\x1b[3P", " C"},
+};
+
+static dazzle_allocator_t alloc = {malloc, free};
+
+static void row_text(bt_grid_t* grid, uint32_t row, char* out, size_t size) {
+    size_t len = 0, end = 0;
+    for (uint32_t col = 0; col < grid->cols; col++) {
+        const bt_cell_t* cell = bt_grid_cell(grid, col, row);
+        if (cell->attrs & BT_ATTR_WIDE_CONT)
+            continue;
+        uint8_t bytes[4];
+        size_t n = utf8_encode(cell->codepoint == 0 ? ' ' : cell->codepoint, bytes);
+        if (len + n >= size)
+            break;
+        memcpy(out + len, bytes, n);
+        len += n;
+        if (cell->codepoint != 0 && cell->codepoint != ' ')
+            end = len;
+    }
+    out[end] = '\0';
+}
+
+// Every left half has its right half next to it and the other way around
+static bool wide_pairs_intact(bt_grid_t* grid, uint32_t* bad_col, uint32_t* bad_row) {
+    for (uint32_t row = 0; row < grid->rows; row++) {
+        for (uint32_t col = 0; col < grid->cols; col++) {
+            uint16_t attrs = bt_grid_cell(grid, col, row)->attrs;
+            bool left = (attrs & BT_ATTR_WIDE) && col + 1 < grid->cols;
+            bool cont = attrs & BT_ATTR_WIDE_CONT;
+            if ((left && !(bt_grid_cell(grid, col + 1, row)->attrs & BT_ATTR_WIDE_CONT)) ||
+                (cont && (col == 0 || !(bt_grid_cell(grid, col - 1, row)->attrs & BT_ATTR_WIDE)))) {
+                *bad_col = col;
+                *bad_row = row;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static int run_cases(void) {
+    int failures = 0;
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bt_grid_t* grid = bt_grid_create(alloc, COLS, ROWS);
+        bt_vt_t* vt = bt_vt_create(alloc, grid, NULL);
+        bt_vt_feed(vt, cases[i].input, strlen(cases[i].input));
+
+        char text[COLS * 4 + 1];
+        uint32_t col, row;
+        row_text(grid, 0, text, sizeof(text));
+        if (strcmp(text, cases[i].row) != 0) {
+            printf("FAIL %s: row is \"%s\", expected \"%s\"\n", cases[i].name, text, cases[i].row);
+            failures++;
+        } else if (!wide_pairs_intact(grid, &col, &row)) {
+            printf("FAIL %s: broken wide character at %u,%u\n", cases[i].name, col, row);
+            failures++;
+        }
+        bt_vt_destroy(vt);
+        bt_grid_destroy(grid);
+    }
+    return failures;
+}
+
+// Random edits around wide characters must never leave half of one behind
+static int run_random(void) {
+    static const char* pieces[] = {"a", "\xe4\xb8\xad", "\xe4\xb8\xad\xe4\xb8\xad", "\x1b[@", "\x1b[2@", "\x1b[P",
+                                   "\x1b[3P", "\x1b[X", "\x1b[2X", "\x1b[D", "\x1b[C", "\x1b[K", "\x1b[1K", "\r\n"};
+    int failures = 0;
+    srand(1);
+    for (int round = 0; round < 2000 && failures < 5; round++) {
+        bt_grid_t* grid = bt_grid_create(alloc, COLS, ROWS);
+        bt_vt_t* vt = bt_vt_create(alloc, grid, NULL);
+        char input[1024];
+        size_t len = 0;
+        for (int i = 0; i < 40; i++) {
+            const char* piece = pieces[rand() % (sizeof(pieces) / sizeof(pieces[0]))];
+            char moved[16];
+            if (rand() % 4 == 0) {
+                snprintf(moved, sizeof(moved), "\x1b[%d;%dH", 1 + rand() % ROWS, 1 + rand() % COLS);
+                piece = moved;
+            }
+            size_t n = strlen(piece);
+            memcpy(input + len, piece, n);
+            len += n;
+            bt_vt_feed(vt, piece, n);
+
+            uint32_t col, row;
+            if (!wide_pairs_intact(grid, &col, &row)) {
+                printf("FAIL random round %d: broken wide character at %u,%u after:", round, col, row);
+                for (size_t k = 0; k < len; k++)
+                    printf(input[k] >= 0x20 && input[k] < 0x7F ? "%c" : "\\x%02x", (uint8_t)input[k]);
+                printf("\n");
+                failures++;
+                break;
+            }
+        }
+        bt_vt_destroy(vt);
+        bt_grid_destroy(grid);
+    }
+    return failures;
+}
+
+static bool same_grid(bt_grid_t* a, bt_grid_t* b) {
+    for (uint32_t row = 0; row < a->rows; row++)
+        for (uint32_t col = 0; col < a->cols; col++)
+            if (memcmp(bt_grid_cell(a, col, row), bt_grid_cell(b, col, row), sizeof(bt_cell_t)) != 0)
+                return false;
+    return true;
+}
+
+// Lines arriving in one feed scroll in batches, the screen must end up as if fed byte by byte
+static int run_batched(void) {
+    static const char* pieces[] = {"a", "hello ", "\r\n", "\n", "\r", "\n\n", "\x0b", "\x1b[2;3r", "\x1b[r",
+                                   "\x1b[3;1H", "\x1b[31m", "\xe4\xb8\xad", "\x1b[?7l", "\x1b[?7h"};
+    int failures = 0;
+    srand(2);
+    for (int round = 0; round < 2000 && failures < 5; round++) {
+        bt_grid_t* whole = bt_grid_create(alloc, COLS, ROWS);
+        bt_grid_t* bytes = bt_grid_create(alloc, COLS, ROWS);
+        bt_vt_t* vt_whole = bt_vt_create(alloc, whole, NULL);
+        bt_vt_t* vt_bytes = bt_vt_create(alloc, bytes, NULL);
+        char input[1024];
+        size_t len = 0;
+        for (int i = 0; i < 60; i++) {
+            const char* piece = pieces[rand() % (sizeof(pieces) / sizeof(pieces[0]))];
+            size_t n = strlen(piece);
+            memcpy(input + len, piece, n);
+            len += n;
+        }
+        bt_vt_feed(vt_whole, input, len);
+        for (size_t i = 0; i < len; i++)
+            bt_vt_feed(vt_bytes, input + i, 1);
+
+        if (!same_grid(whole, bytes) || vt_whole->cursor.x != vt_bytes->cursor.x || vt_whole->cursor.y != vt_bytes->cursor.y) {
+            printf("FAIL batched round %d: differs from feeding byte by byte\n", round);
+            failures++;
+        }
+        bt_vt_destroy(vt_whole);
+        bt_vt_destroy(vt_bytes);
+        bt_grid_destroy(whole);
+        bt_grid_destroy(bytes);
+    }
+    return failures;
+}
+
+int main(void) {
+    int failures = run_cases() + run_random() + run_batched();
+    printf("%s, %d failure%s\n", failures == 0 ? "ok" : "FAILED", failures, failures == 1 ? "" : "s");
+    return failures;
+}
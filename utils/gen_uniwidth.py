@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+# Generates uniwidth_table.h, the per codepoint width and class table behind uniwidth.h.
+# The data comes from the unicodedata module, so the table follows the Python it runs on.
+#
+#   python3 gen_uniwidth.py > uniwidth_table.h
+
+import sys
+import unicodedata
+
+# Must match uniwidth.h
+UNI_WIDTH_MASK = 0x03
+UNI_COMBINING  = 0x04
+UNI_ZERO_WIDTH = 0x08
+UNI_CONTROL    = 0x10
+UNI_AMBIGUOUS  = 0x20
+UNI_UNASSIGNED = 0x40
+
+CODEPOINTS = 0x110000
+
+# East_Asian_Width defaults these to W even where nothing is assigned yet
+WIDE_DEFAULTS = [(0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF), (0x20000, 0x2FFFD), (0x30000, 0x3FFFD)]
+
+
+def classify(c):
+    ch = chr(c)
+    cat = unicodedata.category(ch)
+    eaw = unicodedata.east_asian_width(ch)
+
+    if c == 0:
+        return 0
+    if cat == "Cc":
+        return UNI_CONTROL
+    if cat in ("Mn", "Me"):
+        return UNI_COMBINING
+    # Soft hyphen is shown, the rest of the format characters are not
+    if (cat == "Cf" and c != 0x00AD) or c == 0x200B:
+        return UNI_ZERO_WIDTH
+    # Hangul medial vowels and final consonants join the syllable before them
+    if 0x1160 <= c <= 0x11FF or 0xD7B0 <= c <= 0xD7FF:
+        return UNI_ZERO_WIDTH
+
+    cls = 1
+    if eaw in ("W", "F") or any(lo <= c <= hi for lo, hi in WIDE_DEFAULTS):
+        cls = 2
+    elif eaw == "A":
+        cls |= UNI_AMBIGUOUS
+    if cat in ("Cn", "Cs"):
+        cls |= UNI_UNASSIGNED
+    return cls
+
+
+def dedup(values, size):
+    """Splits values into blocks of size, returns the unique blocks and each block's index."""
+    blocks, index, ids = [], {}, []
+    for i in range(0, len(values), size):
+        block = tuple(values[i:i + size])
+        if block not in index:
+            index[block] = len(blocks)
+            blocks.append(block)
+        ids.append(index[block])
+    return blocks, ids
+
+
+def ctype(limit):
+    return ("uint8_t", 1) if limit < 256 else ("uint16_t", 2)
+
+
+def build(values, shift2, shift3):
+    """Three stages: stage1[c >> (shift2 + shift3)] -> stage2 block, -> stage3 block, -> class."""
+    blocks3, ids3 = dedup(values, 1 << shift3)
+    blocks2, ids2 = dedup(ids3, 1 << shift2)
+    t1, s1 = ctype(len(blocks2))
+    t2, s2 = ctype(len(blocks3))
+    size = len(ids2) * s1 + len(blocks2) * (1 << shift2) * s2 + len(blocks3) * (1 << shift3)
+    return size, (shift2, shift3, ids2, blocks2, blocks3, t1, t2)
+
+
+def emit(name, ctype_name, values, out):
+    out.write("static const %s %s[%d] = {\n" % (ctype_name, name, len(values)))
+    for i in range(0, len(values), 16):
+        out.write("    " + ", ".join("0x%02X" % v for v in values[i:i + 16]) + ",\n")
+    out.write("};\n\n")
+
+
+def main():
+    values = [classify(c) for c in range(CODEPOINTS)]
+
+    best = None
+    for shift3 in range(4, 9):
+        for shift2 in range(2, 9):
+            size, table = build(values, shift2, shift3)
+            if best is None or size < best[0]:
+                best = (size, table)
+    size, (shift2, shift3, stage1, blocks2, blocks3, t1, t2) = best
+
+    out = sys.stdout
+    out.write("#ifndef __UNIWIDTH_TABLE_H__\n#define __UNIWIDTH_TABLE_H__\n\n")
+    out.write("// Generated by gen_uniwidth.py from Unicode %s, do not edit.\n" % unicodedata.unidata_version)
+    out.write("// %d bytes in three stages, see uni_class in uniwidth.h\n\n" % size)
+    out.write("#include <stdint.h>\n\n")
+    out.write("#define UNI_TABLE_VERSION \"%s\"\n" % unicodedata.unidata_version)
+    out.write("#define __UNI_SHIFT2 %d\n" % shift2)
+    out.write("#define __UNI_SHIFT3 %d\n\n" % shift3)
+    emit("__uni_stage1", t1, stage1, out)
+    emit("__uni_stage2", t2, [i for block in blocks2 for i in block], out)
+    emit("__uni_stage3", "uint8_t", [v for block in blocks3 for v in block], out)
+    out.write("#endif // __UNIWIDTH_TABLE_H__\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,97 @@
+#ifndef __UNIWIDTH_H__
+#define __UNIWIDTH_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(__SSE2__) && !defined(UNI_NO_SIMD)
+    #include <emmintrin.h>
+    #define UNI_SIMD_SSE2 1
+#endif
+
+#include "uniwidth_table.h"
+
+// Class bits of a codepoint, the low two are the cells it takes
+#define UNI_WIDTH_MASK 0x03
+#define UNI_COMBINING  0x04 // nonspacing or enclosing mark, goes on the character before it
+#define UNI_ZERO_WIDTH 0x08 // format characters and the like, not drawn at all
+#define UNI_CONTROL    0x10 // C0 and C1 controls
+#define UNI_AMBIGUOUS  0x20 // East Asian ambiguous, one cell here but two in CJK contexts
+#define UNI_UNASSIGNED 0x40 // nothing assigned yet as of UNI_TABLE_VERSION
+
+/*
+ * @brief Looks up the class bits of a codepoint, three loads from the generated table
+ *
+ * @param c The codepoint
+ *
+ * @return The UNI_* bits, anything past U+10FFFF is one unassigned cell
+*/
+static inline uint8_t uni_class(uint32_t c){
+    if(c >= 0x110000){
+        return 1 | UNI_UNASSIGNED;
+    }
+    uint32_t block = __uni_stage1[c >> (__UNI_SHIFT2 + __UNI_SHIFT3)];
+    block = __uni_stage2[(block << __UNI_SHIFT2) | ((c >> __UNI_SHIFT3) & ((1 << __UNI_SHIFT2) - 1))];
+    return __uni_stage3[(block << __UNI_SHIFT3) | (c & ((1 << __UNI_SHIFT3) - 1))];
+}
+
+/*
+ * @brief The number of cells a codepoint takes, like wcwidth
+ *
+ * @param c The codepoint
+ *
+ * @return 0, 1 or 2, -1 for control characters
+*/
+static inline int uni_width(uint32_t c){
+    uint8_t cls = uni_class(c);
+    return cls & UNI_CONTROL ? -1 : (int)(cls & UNI_WIDTH_MASK);
+}
+
+/*
+ * @brief Measures the run of printable ascii at the start of a buffer
+ *
+ * Every byte of such a run is one character of one cell, so callers can
+ * skip decoding and table lookups for it entirely.
+ *
+ * @param s The bytes
+ * @param len How many there are
+ *
+ * @return The length of the run, 0x20 to 0x7E
+*/
+static inline size_t uni_ascii_run(const uint8_t *s, size_t len){
+    size_t i = 0;
+#ifdef UNI_SIMD_SSE2
+    // bytes from 0x80 up are negative, so one signed compare catches them and the controls
+    const __m128i space = _mm_set1_epi8(0x20), del = _mm_set1_epi8(0x7F);
+    for(; i + 16 <= len; i += 16){
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+        __m128i bad = _mm_or_si128(_mm_cmpgt_epi8(space, v), _mm_cmpeq_epi8(v, del));
+        int mask = _mm_movemask_epi8(bad);
+        if(mask != 0){
+            return i + __builtin_ctz(mask);
+        }
+    }
+#endif
+    while(i < len && s[i] >= 0x20 && s[i] < 0x7F){
+        i++;
+    }
+    return i;
+}
+
+/*
+ * @brief Adds up the cells a run of codepoints takes
+ *
+ * @param cps The codepoints
+ * @param count How many there are
+ *
+ * @return The total, controls count as nothing
+*/
+static inline size_t uni_width_sum(const uint32_t *cps, size_t count){
+    size_t cells = 0;
+    for(size_t i = 0; i < count; i++){
+        cells += cps[i] >= 0x20 && cps[i] < 0x7F ? 1 : uni_class(cps[i]) & UNI_WIDTH_MASK;
+    }
+    return cells;
+}
+
+#endif // __UNIWIDTH_H__
@@ -2,12 +2,20 @@
 #define __UTF8_H__
 
 #include <stdint.h>
+#include <stddef.h>
 #include <sys/types.h>
 
+#if defined(__SSE2__) && !defined(UTF8_NO_SIMD)
+    #include <emmintrin.h>
+    #define UTF8_SIMD_SSE2 1
+#endif
+
 #define UTF8_CODEPOINT_EXTRACTED 0
 #define UTF8_MORE_BYTES_REQUIRED 1
 #define UTF8_INVALID_INPUT       2
 
+#define UTF8_REPLACEMENT_CHARACTER 0xFFFD
+
 typedef struct {
     uint8_t bytes_remaining;
     uint8_t num_bytes;
@@ -25,10 +33,108 @@ typedef struct {
 */
 uint8_t utf8_decode(utf8_dec_state_t *state, uint8_t c, uint32_t *out);
 
+/*
+ * @brief Decodes a buffer of utf8, 16 bytes at a time with SSE2
+ * 
+ * Runs of ascii are widened, other text is validated and decoded a block at
+ * a time, and only broken input goes through utf8_decode byte by byte.
+ * 
+ * Overlong forms, surrogates and values past U+10FFFF are rejected like any
+ * other broken input: each maximal invalid subpart becomes one
+ * UTF8_REPLACEMENT_CHARACTER and the state starts over. A sequence cut off at
+ * the end of the buffer stays in the state and continues with the next one.
+ * 
+ * @param state The state of the decoder
+ * @param in The bytes to decode
+ * @param len How many there are
+ * @param out The decoded characters
+ * @param max Room in out, decoding stops when it is full
+ * @param consumed Set to how many bytes were used, may be NULL
+ * 
+ * @return The number of characters written to out
+*/
+size_t utf8_decode_buf(utf8_dec_state_t *state, const uint8_t *in, size_t len, uint32_t *out, size_t max, size_t *consumed);
+
+/*
+ * @brief Encodes a character as utf8
+ * 
+ * @param c The character, surrogates and values past U+10FFFF are written as UTF8_REPLACEMENT_CHARACTER
+ * @param out Room for at least 4 bytes
+ * 
+ * @return The number of bytes written
+*/
+size_t utf8_encode(uint32_t c, uint8_t *out);
+
 #ifdef __UTF8_IMPL__
+#ifdef UTF8_SIMD_SSE2
+    // bytes at or above t, compared signed after flipping the top bit
+    #define __UTF8_GE(u, t) _mm_cmpgt_epi8(u, _mm_set1_epi8((char)(((t) - 1) ^ 0x80)))
+
+    /*
+     * @brief Validates 16 bytes starting at a character and decodes the characters that end in them
+     * 
+     * The lead masks shifted along by 1 to 3 bytes say where continuations have
+     * to be. Any other byte there, a byte that never leads, or a second byte
+     * making an overlong form, a surrogate or a value past U+10FFFF fails the
+     * block. A sequence cut off at the end is left for the next block.
+     * 
+     * @param in 16 bytes, the first one starts a character
+     * @param out Room for 16 characters
+     * @param count Set to the number of characters written
+     * 
+     * @return The bytes used, 0 if the block has to go through utf8_decode
+    */
+    static inline size_t __utf8_decode_block(const uint8_t *in, uint32_t *out, size_t *count){
+        __m128i v = _mm_loadu_si128((const __m128i*)in);
+        __m128i u = _mm_xor_si128(v, _mm_set1_epi8((char)0x80));
+        __m128i cont = _mm_cmplt_epi8(v, _mm_set1_epi8(-64));
+        __m128i lead2 = __UTF8_GE(u, 0xC2), lead3 = __UTF8_GE(u, 0xE0), lead4 = __UTF8_GE(u, 0xF0);
+        __m128i bad = _mm_or_si128(_mm_andnot_si128(lead2, __UTF8_GE(u, 0xC0)), __UTF8_GE(u, 0xF5));
+
+        __m128i required = _mm_or_si128(_mm_slli_si128(lead2, 1), _mm_or_si128(_mm_slli_si128(lead3, 2), _mm_slli_si128(lead4, 3)));
+        __m128i error = _mm_or_si128(bad, _mm_xor_si128(required, cont));
+
+        // the second byte is at least A0 after E0 and 90 after F0, below A0 after ED and 90 after F4
+        __m128i floor = _mm_slli_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8((char)0xE0)), _mm_cmpeq_epi8(v, _mm_set1_epi8((char)0xF0))), 1);
+        __m128i ceiling = _mm_slli_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8((char)0xED)), _mm_cmpeq_epi8(v, _mm_set1_epi8((char)0xF4))), 1);
+        __m128i above = _mm_or_si128(_mm_and_si128(_mm_slli_si128(lead4, 1), __UTF8_GE(u, 0x90)), _mm_andnot_si128(_mm_slli_si128(lead4, 1), __UTF8_GE(u, 0xA0)));
+        error = _mm_or_si128(error, _mm_or_si128(_mm_andnot_si128(above, floor), _mm_and_si128(above, ceiling)));
+        if(_mm_movemask_epi8(error) != 0){
+            return 0;
+        }
+
+        uint32_t m2 = (uint32_t)_mm_movemask_epi8(lead2), m3 = (uint32_t)_mm_movemask_epi8(lead3), m4 = (uint32_t)_mm_movemask_epi8(lead4);
+        uint32_t cut = (m2 & 0x8000) | (m3 & 0xC000) | (m4 & 0xE000);
+        uint32_t end = cut != 0 ? (uint32_t)__builtin_ctz(cut) : 16;
+        uint32_t starts = ~(uint32_t)_mm_movemask_epi8(cont) & ((1u << end) - 1);
+
+        // every character is put together from 4 bytes and the ones past its end shifted out,
+        // the copy gives the last ones something to read
+        static const uint8_t lead_bits[5] = {0, 0x7F, 0x1F, 0x0F, 0x07};
+        uint8_t bytes[20] = {0};
+        _mm_storeu_si128((__m128i*)bytes, v);
+        size_t n = 0;
+        while(starts != 0){
+            uint32_t p = (uint32_t)__builtin_ctz(starts);
+            starts &= starts - 1;
+            uint32_t length = (starts != 0 ? (uint32_t)__builtin_ctz(starts) : end) - p;
+            const uint8_t *s = bytes + p;
+            uint32_t cp = (uint32_t)(s[0] & lead_bits[length]) << 18 | (uint32_t)(s[1] & 0x3F) << 12 | (uint32_t)(s[2] & 0x3F) << 6 | (s[3] & 0x3F);
+            out[n++] = cp >> (6 * (4 - length));
+        }
+        *count = n;
+        return end;
+    }
+
+    #undef __UTF8_GE
+#endif
+
     uint8_t utf8_decode(utf8_dec_state_t *state, uint8_t c, uint32_t *out){
         if (state->bytes_remaining == 0){
-            if (c == 0xFF) {
+            if (c < 0x80){ // 1 byte long(may be a non-ascii invalid character)
+                *out = (uint32_t)c;
+                return UTF8_CODEPOINT_EXTRACTED;
+            } else if (c < 0xc2 || c > 0xf4){ // continuation byte, overlong 2 byte lead, or past U+10FFFF
                 return UTF8_INVALID_INPUT;
             } else if (c >= 0xf0){ // 4 bytes long
                 state->num_bytes = 4;
@@ -40,22 +146,27 @@ uint8_t utf8_decode(utf8_dec_state_t *state, uint8_t c, uint32_t *out);
                 state->bytes_remaining = 2;
                 state->codepoint = c & 0x0F;
                 return UTF8_MORE_BYTES_REQUIRED;
-            } else if (c >= 0xc0){ // 2 bytes long
+            } else { // 2 bytes long
                 state->num_bytes = 2;
                 state->bytes_remaining = 1;
                 state->codepoint = c & 0x1F;
                 return UTF8_MORE_BYTES_REQUIRED;
-            } else if (c >= 0x80){ // continuation byte, not supposed to be here
-                return UTF8_INVALID_INPUT;
-            } else { // 1 byte long(may be a non-ascii invalid character)
-                *out = (uint32_t)c;
-                return UTF8_CODEPOINT_EXTRACTED;
             }
         } else {
             if((c & 0xC0) != 0x80){ // the first 2 bits have to be 0b10
                 return UTF8_INVALID_INPUT;
             } 
-            state->codepoint = (c & 0x3F) | (state->codepoint << 6);
+            uint32_t codepoint = (c & 0x3F) | (state->codepoint << 6);
+            // the second byte is enough to tell overlongs, surrogates and values past U+10FFFF
+            if(state->bytes_remaining == state->num_bytes - 1){
+                if(state->num_bytes == 3 && (codepoint < 0x20 || (codepoint >= 0x360 && codepoint < 0x380))){
+                    return UTF8_INVALID_INPUT;
+                }
+                if(state->num_bytes == 4 && (codepoint < 0x10 || codepoint > 0x10F)){
+                    return UTF8_INVALID_INPUT;
+                }
+            }
+            state->codepoint = codepoint;
             state->bytes_remaining--;
             if(state->bytes_remaining == 0){
                 *out = state->codepoint;
@@ -64,6 +175,90 @@ uint8_t utf8_decode(utf8_dec_state_t *state, uint8_t c, uint32_t *out);
             return UTF8_MORE_BYTES_REQUIRED;
         }
     }
+
+    size_t utf8_decode_buf(utf8_dec_state_t *state, const uint8_t *in, size_t len, uint32_t *out, size_t max, size_t *consumed){
+        size_t i = 0, n = 0;
+        while(i < len && n < max){
+            if(state->bytes_remaining == 0){
+#ifdef UTF8_SIMD_SSE2
+                // no byte with the top bit set means 16 characters, zero extended twice
+                const __m128i zero = _mm_setzero_si128();
+                while(i + 16 <= len && n + 16 <= max){
+                    __m128i v = _mm_loadu_si128((const __m128i*)(in + i));
+                    if(_mm_movemask_epi8(v) != 0){
+                        // anything else is validated 16 bytes at a time, broken input is left to utf8_decode
+                        size_t count, used = __utf8_decode_block(in + i, out + n, &count);
+                        if(used == 0){
+                            break;
+                        }
+                        i += used;
+                        n += count;
+                        continue;
+                    }
+                    __m128i lo = _mm_unpacklo_epi8(v, zero), hi = _mm_unpackhi_epi8(v, zero);
+                    _mm_storeu_si128((__m128i*)(out + n), _mm_unpacklo_epi16(lo, zero));
+                    _mm_storeu_si128((__m128i*)(out + n + 4), _mm_unpackhi_epi16(lo, zero));
+                    _mm_storeu_si128((__m128i*)(out + n + 8), _mm_unpacklo_epi16(hi, zero));
+                    _mm_storeu_si128((__m128i*)(out + n + 12), _mm_unpackhi_epi16(hi, zero));
+                    i += 16;
+                    n += 16;
+                }
+#endif
+                while(i < len && n < max && in[i] < 0x80){
+                    out[n++] = in[i++];
+                }
+                if(i == len || n == max){
+                    break;
+                }
+            }
+
+            uint32_t cp;
+            uint8_t status = utf8_decode(state, in[i], &cp);
+            if(status == UTF8_INVALID_INPUT){
+                // a sequence cut short is replaced as a whole, the byte that cut it starts over
+                if(state->bytes_remaining == 0){
+                    i++;
+                }
+                *state = (utf8_dec_state_t){0, 0, 0};
+                out[n++] = UTF8_REPLACEMENT_CHARACTER;
+                continue;
+            }
+            i++;
+            if(status == UTF8_CODEPOINT_EXTRACTED){
+                out[n++] = cp;
+            }
+        }
+        if(consumed != NULL){
+            *consumed = i;
+        }
+        return n;
+    }
+
+    size_t utf8_encode(uint32_t c, uint8_t *out){
+        if(c < 0x80){
+            out[0] = (uint8_t)c;
+            return 1;
+        }
+        if(c < 0x800){
+            out[0] = 0xC0 | (c >> 6);
+            out[1] = 0x80 | (c & 0x3F);
+            return 2;
+        }
+        if(c > 0x10FFFF || (c >= 0xD800 && c < 0xE000)){
+            c = UTF8_REPLACEMENT_CHARACTER;
+        }
+        if(c < 0x10000){
+            out[0] = 0xE0 | (c >> 12);
+            out[1] = 0x80 | ((c >> 6) & 0x3F);
+            out[2] = 0x80 | (c & 0x3F);
+            return 3;
+        }
+        out[0] = 0xF0 | (c >> 18);
+        out[1] = 0x80 | ((c >> 12) & 0x3F);
+        out[2] = 0x80 | ((c >> 6) & 0x3F);
+        out[3] = 0x80 | (c & 0x3F);
+        return 4;
+    }
 #endif
 
 #endif // __UTF8_H__
\ No newline at end of file